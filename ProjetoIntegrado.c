@@ -6,7 +6,20 @@
 #include "hardware/pwm.h"
 #include "hardware/clocks.h"
 #include "inc/ssd1306.h"  
-#include "ws2812.pio.h"
+#include "inc/matrix.h"
+#include "inc/audio.h"
+#include "inc/pcm.h"
+#include "inc/sfx.h"
+#include "inc/scheduler.h"
+#include "inc/game_state.h"
+#include "inc/render_core.h"
+#include "inc/joystick.h"
+#include "inc/input_events.h"
+#include "inc/buttons.h"
+#include "inc/profiler.h"
+#include "inc/replay.h"
+#include "inc/tilemap.h"
+#include "inc/sprites.h"
 
 // Definição dos pinos correspondentes aos botões, buzzers, LEDs e Joystick
 #define BUTTON_A_PIN 5
@@ -16,60 +29,122 @@
 #define BUZZER_B_PIN 21 
 #define JOYSTICK_X_PIN 26
 #define JOYSTICK_Y_PIN 27
+#define JOYSTICK_X_INPUT 1 // Canal do ADC do eixo X
+#define JOYSTICK_Y_INPUT 0 // Canal do ADC do eixo Y
 #define JOYSTICK_BUTTON_PIN 22
 #define LED_GREEN_PIN 11
 #define LED_BLUE_PIN 12
 #define LED_RED_PIN 13
 
-#define NUM_PIXELS 25 // Define o número de LEDs RGB
+// Tempo que cada botão precisa ficar estável para valer (debounce na PIO)
+#define BUTTON_A_DEBOUNCE_US 10000
+#define BUTTON_B_DEBOUNCE_US 20000 // Reinicia no bootloader: mais conservador
+#define JOYSTICK_BUTTON_DEBOUNCE_US 15000 // Contato do joystick repica mais
+
+#define NUM_PIXELS MATRIX_NUM_PIXELS // Define o número de LEDs RGB
 
 // Definição dos parâmetros do display OLED
 #define SSD1306_WIDTH 128
 #define SSD1306_HEIGHT 64
 #define SSD1306_ADDR 0x3C
+#define SSD1306_MAX_BAUD SSD1306_BAUD_FAST_PLUS // Taxa tentada no barramento do OLED (cai para 400 kHz se houver NAK)
+
+// Segundo painel opcional com o placar, no mesmo barramento: seus envios têm
+// prioridade e passam à frente dos quadros do painel principal
+#ifndef SCOREBOARD_PANEL
+#define SCOREBOARD_PANEL 0
+#endif
+#define SCOREBOARD_ADDR 0x3D
 
 // Definição dos parâmetros do I2C
 #define I2C_PORT i2c1
 #define SDA_PIN 14
 #define SCL_PIN 15
 
+// Períodos das tarefas do escalonador (a simulação usa a variável delay)
+#define INPUT_PERIOD_US 1000      // Leitura do joystick a 1 kHz
+#define OLED_PERIOD_US 16667      // Display OLED a 60 Hz
+#define MATRIX_PERIOD_US 33333    // Matriz de LEDs a 30 Hz
+
+// Renderização no núcleo 1: o núcleo 0 só simula e publica snapshots
+#ifndef RENDER_ON_CORE1
+#define RENDER_ON_CORE1 1
+#endif
+#define PUBLISH_PERIOD_US 16667   // Snapshots para o núcleo 1 a 60 Hz
+
+// Gravação da semente e das entradas de cada passo (linhas "@rpl" na USB)
+#ifndef RECORD_INPUT
+#define RECORD_INPUT 1
+#endif
+
+// Tela do jogo no OLED: o campo à esquerda da divisória e o HUD (5
+// caracteres, páginas 0 a 4) à direita. Se cada célula couber num tile de
+// uma página com pelo menos 4 colunas, o campo usa os sprites (16 colunas,
+// ou as centrais que couberem); senão vira blocos de pixels (FIELD_BLOCKS),
+// o que acomoda até 32 colunas e 64 linhas. Um campo ainda mais alto não é
+// espelhado. O fundo de estrelas ocupa as páginas livres abaixo dos dois.
+#define FIELD_X 0
+#define FIELD_PAGE 0
+#define HUD_X (SSD1306_WIDTH - 5 * 8)
+#define HUD_PAGES 5
+#define DIVIDER_X (HUD_X - 5)
+#define FIELD_AREA_WIDTH (DIVIDER_X - 3 - FIELD_X)
+#define FIELD_AREA_HEIGHT (SSD1306_HEIGHT - FIELD_PAGE * 8)
+#define FIELD_TILE_WIDTH MIN(SPRITE_WIDTH, FIELD_AREA_WIDTH / PLAYFIELD_WIDTH)
+#define FIELD_MIRROR (PLAYFIELD_HEIGHT <= FIELD_AREA_HEIGHT)
+#define FIELD_BLOCKS (FIELD_TILE_WIDTH < 4 || PLAYFIELD_HEIGHT * 8 > FIELD_AREA_HEIGHT)
+#if !FIELD_MIRROR
+#define FIELD_CELL_HEIGHT 0
+#elif FIELD_BLOCKS
+#define FIELD_CELL_HEIGHT MIN(8, FIELD_AREA_HEIGHT / PLAYFIELD_HEIGHT)
+#else
+#define FIELD_CELL_HEIGHT 8
+#endif
+#define FIELD_PAGES (FIELD_PAGE + (PLAYFIELD_HEIGHT * FIELD_CELL_HEIGHT + 7) / 8)
+#define STARFIELD_FIRST_PAGE MAX(HUD_PAGES, FIELD_PAGES)
+#define STARFIELD_LAST_PAGE (SSD1306_HEIGHT / 8 - 1)
+#define STAR_COUNT 16
+#define STARFIELD_SEED 0x5EED     // Gerador próprio: não consome game_rand (reprodução)
+
+#if FIELD_MIRROR
+_Static_assert(PLAYFIELD_WIDTH <= TILEMAP_MAX_COLS && PLAYFIELD_HEIGHT <= TILEMAP_MAX_ROWS,
+               "campo de jogo maior que o tilemap do OLED");
+#endif
+
+#if FIELD_BLOCKS && FIELD_MIRROR
+// Estilo de cada sprite no modo de blocos
+static const uint8_t sprite_blocks[SPRITE_COUNT] = {
+    [SPRITE_EMPTY] = TILEMAP_BLOCK_EMPTY,
+    [SPRITE_SHIP] = TILEMAP_BLOCK_SOLID,
+    [SPRITE_OBSTACLE] = TILEMAP_BLOCK_SPACED,
+    [SPRITE_CRASH] = TILEMAP_BLOCK_FRAME,
+};
+#endif
+
 // Definição do erro de margem para o joystick
 #define MARGIN_OF_ERROR 200
 
-// Definição dos componentes do jogo
-#define OBSTACLE 2
-#define SHIP 1
-#define EMPTY 0
-
-// Definição da estrutura RGB para representar as cores
-typedef struct {
-    double R; // Intensidade da cor vermelha
-    double G; // Intensidade da cor verde
-    double B; // Intensidade da cor azul
-} RGB;
+// Cores dos componentes do jogo (8 bits por canal; gama e brilho são aplicados na conversão)
+const RGB COLOR_SHIP = {0, 0, 255};
+const RGB COLOR_OBSTACLE = {255, 0, 0};
+const RGB COLOR_EMPTY = {0, 0, 0};
 
 volatile bool collision = false; // Variável para verificar colisão
-volatile uint32_t button_a_time = 0; // Variável para debounce do botão A
-volatile uint32_t button_b_time = 0; // Variável para debounce do botão B
-volatile uint32_t joystick_button_time = 0; // Variável para debounce do botão do joystick
-PIO pio; //Variável para armazenar a configuração da PIO
-uint sm; //Variável para armazenar o estado da máquina
+matrix_t matrix; // Matriz de LEDs WS2812 (PIO + DMA)
 ssd1306_t ssd; // Declaração da estrutura do display OLED
+#if SCOREBOARD_PANEL
+ssd1306_t scoreboard; // Painel do placar
+#endif
 uint score = 0; // Variável para armazenar a pontuação
 uint delay = 300;
-int ship_pos = 2; // Posição inicial da nave (coluna)
-uint8_t space[5][5] = {0};
+int ship_pos = PLAYFIELD_WIDTH / 2; // Posição inicial da nave (coluna)
+playfield_t space; // Obstáculos em bitboards (uma palavra por linha)
 bool start_game = false; // Variável para verificar se o jogo começou
-
-// Função para debounce dos botões
-bool debounce(volatile uint32_t *last_time){
-    uint32_t current_time = to_ms_since_boot(get_absolute_time());
-    if (current_time - *last_time > 250){ 
-        *last_time = current_time;
-        return true;
-    }
-    return false;
-}
+task_t *simulation_task; // Tarefa da simulação, cujo período acompanha delay
+uint32_t rng_state; // Estado do gerador dos obstáculos (game_rand)
+bool replaying = false; // Reprodução headless em andamento: sem som nem displays
+bool replay_exit = false; // Botão B durante a reprodução encerra o log
+tilemap_t field_tiles; // Campo de jogo desenhado no OLED (tiles do último quadro)
 
 // Função para inicialização dos LEDs
 void init_leds(){
@@ -95,6 +170,7 @@ void init_buttons(){
     adc_init();
     adc_gpio_init(JOYSTICK_X_PIN);
     adc_gpio_init(JOYSTICK_Y_PIN);
+    joystick_init(JOYSTICK_X_INPUT, JOYSTICK_Y_INPUT); // Captura contínua por DMA
 
     // Inicialização do botão A
     gpio_init(BUTTON_A_PIN);
@@ -112,64 +188,38 @@ void init_buttons(){
     gpio_pull_up(JOYSTICK_BUTTON_PIN);
 }
 
-// Inicializa todos os buzzers
-void buzzer_init_all(){
-    // Inicializa o buzzer A
-    gpio_init(BUZZER_A_PIN);
-    gpio_set_dir(BUZZER_A_PIN, GPIO_OUT);
-    gpio_put(BUZZER_A_PIN, false); // Desliga o buzzer A inicialmente
-
-    // Inicializa o buzzer B
-    gpio_init(BUZZER_B_PIN);
-    gpio_set_dir(BUZZER_B_PIN, GPIO_OUT);
-    gpio_put(BUZZER_B_PIN, false); // Desliga o buzzer B inicialmente
-}
-
-// Configura o PWM no pino do buzzer com uma frequência especificada
-void set_buzzer_frequency(uint pin, uint frequency) {
-    // Obter o slice do PWM associado ao pino
-    uint slice_num = pwm_gpio_to_slice_num(pin);
+// Padrões sonoros: cada evento toca uma nota e acende um LED pela duração indicada
+const audio_event_t denied_pattern[] = {
+    {NOTE_DENIED, LED_RED_PIN, 100},
+    {NOTE_REST, AUDIO_NO_LED, 50},
+    {NOTE_DENIED, LED_RED_PIN, 100},
+};
 
-    // Configurar o pino como saída de PWM
-    gpio_set_function(pin, GPIO_FUNC_PWM);
+const audio_event_t success_pattern[] = {
+    {NOTE_SUCCESS, LED_GREEN_PIN, 100},
+    {NOTE_REST, AUDIO_NO_LED, 50},
+    {NOTE_SUCCESS, LED_GREEN_PIN, 100},
+};
 
-    // Configurar o PWM com frequência desejada
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, clock_get_hz(clk_sys) / (frequency * 4096)); // Calcula divisor do clock
-
-    pwm_init(slice_num, &config, true);
-    pwm_set_gpio_level(pin, 0); // Inicializa com duty cycle 0 (sem som)
-}
-
-// Função para tocar o buzzer por um tempo especificado (em milissegundos)
-void play_buzzer(uint pin, uint frequency, uint duration_ms) {
-
-    set_buzzer_frequency(pin, frequency);   
-    pwm_set_gpio_level(pin, 32768);           
-    sleep_ms(duration_ms);                   
-    pwm_set_gpio_level(pin, 0);              
+// Inicializa todos os buzzers (tons nos dois, efeitos PCM no buzzer A)
+void buzzer_init_all(){
+    audio_init(BUZZER_A_PIN, BUZZER_B_PIN);
+    pcm_init(AUDIO_VOICE_A);
 }
 
-// Função para tocar o som de colisão
+// Função para tocar o som de colisão (explosão PCM no buzzer A, tom e LED vermelho no buzzer B;
+// no A o tom seria calado pelo PCM, que suspende a voz enquanto toca)
 void play_denied_sound(){
-    gpio_put(LED_RED_PIN, true); // Acende LED vermelho
-    play_buzzer(BUZZER_A_PIN, 3300, 100);
-    gpio_put(LED_RED_PIN, false); // Apaga LED vermelho
-    sleep_ms(50);
-    gpio_put(LED_RED_PIN, true); // Acende LED vermelho
-    play_buzzer(BUZZER_A_PIN, 3300, 100);
-    gpio_put(LED_RED_PIN, false); // Apaga LED vermelho
+    if (replaying) return;
+    audio_play(AUDIO_VOICE_B, denied_pattern, count_of(denied_pattern));
+    pcm_play(0, &sfx_explosion, false);
 }
 
-// Função para tocar o som de sucesso 
+// Função para tocar o som de sucesso (tom no buzzer B ao mesmo tempo que o efeito PCM no buzzer A)
 void play_success_sound(){
-    gpio_put(LED_GREEN_PIN, true); // Acende LED verde
-    play_buzzer(BUZZER_A_PIN, 4400, 100);
-    gpio_put(LED_GREEN_PIN, false); // Apaga LED verde
-    sleep_ms(50);
-    gpio_put(LED_GREEN_PIN, true); // Acende LED verde
-    play_buzzer(BUZZER_A_PIN, 4400, 100);
-    gpio_put(LED_GREEN_PIN, false); // Apaga LED verde
+    if (replaying) return;
+    audio_play(AUDIO_VOICE_B, success_pattern, count_of(success_pattern));
+    pcm_play(1, &sfx_level_up, false);
 }
 
 // Função para inicialização do display OLED
@@ -180,230 +230,267 @@ void init_display(ssd1306_t *ssd){
     gpio_pull_up(SDA_PIN);
     gpio_pull_up(SCL_PIN);
     ssd1306_init(ssd, SSD1306_WIDTH, SSD1306_HEIGHT, false, SSD1306_ADDR, I2C_PORT);
+    ssd1306_negotiate_baudrate(ssd, SSD1306_MAX_BAUD);
     ssd1306_config(ssd);
     ssd1306_fill(ssd, false);
     ssd1306_send_data(ssd);
+#if SCOREBOARD_PANEL
+    // A taxa é do barramento: o placar confirma a negociada pelo principal
+    ssd1306_init(&scoreboard, SSD1306_WIDTH, SSD1306_HEIGHT, false, SCOREBOARD_ADDR, I2C_PORT);
+    ssd1306_set_priority(&scoreboard, I2C_PRIORITY_URGENT);
+    ssd1306_negotiate_baudrate(&scoreboard, ssd->baudrate);
+    ssd1306_config(&scoreboard);
+    ssd1306_fill(&scoreboard, false);
+    ssd1306_draw_string_cached(&scoreboard, "SCORE", 44, 16);
+    ssd1306_send_data(&scoreboard);
+#endif
 }
 
-//rotina para inicialização da matrix de leds - ws2812b
-uint matrix_init() {
-    //Configurações da PIO
-    pio = pio0; 
-    uint offset = pio_add_program(pio, &pio_matrix_program);
-    sm = pio_claim_unused_sm(pio, true);
-    pio_matrix_program_init(pio, sm, offset, WS2812_PIN);
- }
- 
-//rotina para definição da intensidade de cores do led
-uint32_t matrix_rgb(double r, double g, double b){
-   unsigned char R, G, B;
-   R = r * 255;
-   G = g * 255;
-   B = b * 255;
-   return (G << 24) | (R << 16) | (B << 8);
+//rotina para definição da intensidade de cores do led (tabelas de gama e brilho, sem ponto flutuante)
+uint32_t matrix_rgb(uint8_t r, uint8_t g, uint8_t b){
+   RGB color = {r, g, b};
+   return matrix_color(&matrix, color);
  }
  
  //rotina para acionar a matrix de leds - ws2812b
-void set_leds(PIO pio, uint sm, double r, double g, double b) {
-     uint32_t valor_led;
-     for (int16_t i = 0; i < NUM_PIXELS; i++) {
-         valor_led = matrix_rgb(r, g, b);
-         pio_sm_put_blocking(pio, sm, valor_led);
-     }
+void set_leds(uint8_t r, uint8_t g, uint8_t b) {
+     matrix_fill(&matrix, matrix_rgb(r, g, b));
+     matrix_show(&matrix);
  }
  
- // Função para converter a posição do matriz para uma posição do vetor.
-int getIndex(int x, int y) {
-    // Se a linha for par (0, 2, 4), percorremos da esquerda para a direita.
-    // Se a linha for ímpar (1, 3), percorremos da direita para a esquerda.
-    if (y % 2 == 0) {
-        return 24-(y * 5 + x); // Linha par (esquerda para direita).
-    } else {
-        return 24-(y * 5 + (4 - x)); // Linha ímpar (direita para esquerda).
-    }
-}
-
-//rotina para acionar a matrix de leds - ws2812b
-void desenho_pio(RGB pixels[NUM_PIXELS], PIO pio, uint sm) {
+//rotina para acionar a matrix de leds - ws2812b (pixels em ordem lógica, linha a linha)
+void desenho_pio(RGB pixels[NUM_PIXELS]) {
     for (int i = 0; i < NUM_PIXELS; i++) {
-        int x = i % 5;
-        int y = i / 5;
-        int index = getIndex(x, y);
-        pio_sm_put_blocking(pio, sm, matrix_rgb(pixels[index].R, pixels[index].G, pixels[index].B));
+        matrix_set_pixel(&matrix, matrix_map[i], matrix_color(&matrix, pixels[i]));
     }
+    matrix_show(&matrix); // Envia por DMA; quadros iguais ao anterior não são retransmitidos
 }
 
 // Função para apagar a matriz de leds.
 void clear_matrix(){
-    RGB BLACK = {0, 0, 0}; // Cor preta (apagado)
-    RGB pixels[NUM_PIXELS];
-    for (int i = 0; i < NUM_PIXELS; i++) {
-        pixels[i] = BLACK;
-    }
-    desenho_pio(pixels, pio0, 0);
+    matrix_fill(&matrix, 0); // Cor preta (apagado)
+    matrix_show_blocking(&matrix);
 }
 
-// Função para movimentação do quadrado no display OLED
-void joystic_movimentation(ssd1306_t *ssd, uint16_t x_value, uint16_t y_value){
-    static uint16_t square_x;
-    static uint16_t square_y;
+// Monta a tela do jogo: divisória, rótulos do HUD e o fundo de estrelas, que
+// depois é rolado pelo próprio painel (sem redesenho nem retransmissão)
+void oled_layout(ssd1306_t *ssd){
+    ssd1306_fill(ssd, false);
+    ssd1306_vline(ssd, DIVIDER_X, 0, STARFIELD_FIRST_PAGE * 8 - 1, true);
+    ssd1306_draw_string_cached(ssd, "SCORE", HUD_X, 0);
+    ssd1306_draw_string_cached(ssd, "SPEED", HUD_X, 24);
+#if FIELD_BLOCKS && FIELD_MIRROR
+    tilemap_init_blocks(&field_tiles, sprite_blocks, FIELD_TILE_WIDTH, FIELD_CELL_HEIGHT,
+                        PLAYFIELD_WIDTH, PLAYFIELD_HEIGHT, FIELD_X, FIELD_PAGE * 8);
+#elif FIELD_MIRROR
+    tilemap_init(&field_tiles, sprites + (SPRITE_WIDTH - FIELD_TILE_WIDTH) / 2, SPRITE_WIDTH, FIELD_TILE_WIDTH,
+                 PLAYFIELD_WIDTH, PLAYFIELD_HEIGHT, FIELD_X, FIELD_PAGE);
+#endif
+#if STARFIELD_FIRST_PAGE <= STARFIELD_LAST_PAGE
+    uint32_t state = STARFIELD_SEED;
+    for (int i = 0; i < STAR_COUNT; i++) {
+        uint8_t x = game_rand(&state) % SSD1306_WIDTH;
+        uint8_t y = game_rand(&state) % ((STARFIELD_LAST_PAGE - STARFIELD_FIRST_PAGE + 1) * 8);
+        ssd1306_pixel(ssd, x, STARFIELD_FIRST_PAGE * 8 + y, true);
+    }
+    ssd1306_scroll_horizontal(ssd, true, STARFIELD_FIRST_PAGE, STARFIELD_LAST_PAGE, SSD1306_SCROLL_25_FRAMES);
+#endif
+}
 
-    square_x = (x_value * SSD1306_WIDTH) / 4095; // Calcula a posição do quadrado no eixo x
-    square_y = SSD1306_HEIGHT - ((y_value * SSD1306_HEIGHT) / 4095); // Calcula a posição do quadrado no eixo y
+// Escreve um número do HUD (5 dígitos, alinhado à esquerda) sobre o valor anterior
+void hud_number(ssd1306_t *ssd, uint value, uint8_t y){
+    char text[6];
+    snprintf(text, sizeof(text), "%-5u", value);
+    for (int i = 0; i < 5; i++)
+        ssd1306_draw_char(ssd, text[i], HUD_X + i * 8, y);
+}
 
-    square_x = (square_x < 0) ? 0 : (square_x > SSD1306_WIDTH - 8) ? SSD1306_WIDTH - 8 : square_x; // Limita a posição do quadrado no eixo x
-    square_y = (square_y < 0) ? 0 : (square_y > SSD1306_HEIGHT - 8) ? SSD1306_HEIGHT - 8 : square_y; // Limita a posição do quadrado no eixo y
+#if SCOREBOARD_PANEL
+// Placar no segundo painel: só a pontuação, enviada quando muda
+void scoreboard_render(const game_snapshot_t *snapshot){
+    static uint shown_score = ~0u;
+    if (snapshot->score != shown_score) {
+        char text[6];
+        shown_score = snapshot->score;
+        snprintf(text, sizeof(text), "%5u", shown_score);
+        for (int i = 0; i < 5; i++)
+            ssd1306_draw_char(&scoreboard, text[i], 44 + i * 8, 32);
+    }
+    ssd1306_send_data_async(&scoreboard);
+}
+#endif
+
+// Desenha um snapshot no OLED: só os tiles e números do HUD que mudaram desde
+// o quadro anterior são redesenhados e, portanto, retransmitidos
+void oled_render(ssd1306_t *ssd, const game_snapshot_t *snapshot){
+    static uint shown_score = ~0u;
+    static uint shown_speed = ~0u;
+    PROFILE_SCOPE(PROFILE_OLED);
+
+#if FIELD_MIRROR
+    static uint8_t ids[PLAYFIELD_HEIGHT][PLAYFIELD_WIDTH]; // Estático: até 2 KB, maior que a pilha do núcleo 1
+    for (int y = 0; y < PLAYFIELD_HEIGHT; y++) {
+        for (int x = 0; x < PLAYFIELD_WIDTH; x++)
+            ids[y][x] = (snapshot->rows[y] >> x) & 1 ? SPRITE_OBSTACLE : SPRITE_EMPTY;
+    }
+    ids[SHIP_ROW][snapshot->ship_pos] = snapshot->collision ? SPRITE_CRASH : SPRITE_SHIP;
+    tilemap_draw(&field_tiles, ssd, &ids[0][0], PLAYFIELD_WIDTH);
+#endif
 
-    ssd1306_fill(ssd, false); // Limpa o display
-    ssd1306_rect(ssd, square_y, square_x, 8, 8, true, true); // Desenha o quadrado
+    if (snapshot->score != shown_score) {
+        shown_score = snapshot->score;
+        hud_number(ssd, shown_score, 8);
+    }
+    if (snapshot->speed != shown_speed) {
+        shown_speed = snapshot->speed;
+        hud_number(ssd, shown_speed, 32);
+    }
+#if SCOREBOARD_PANEL
+    scoreboard_render(snapshot);
+#endif
 
-    ssd1306_send_data(ssd);
+    PROFILE_SCOPE(PROFILE_FLUSH); // O envio é medido à parte (também entra em PROFILE_OLED)
+    ssd1306_send_data_async(ssd); // Envia o quadro por DMA sem bloquear o loop
 }
 
 // Função para gerar um obstáculo aleatório na linha superior
 void generate_obstacle() {
-    uint x = rand() % 5;
-    space[0][x] = OBSTACLE;
+    uint x = game_rand(&rng_state) % PLAYFIELD_WIDTH;
+    playfield_spawn(&space, x);
 }
 
 // Função para mover os obstáculos para baixo
 void move_obstacles() {
-    // Primeiro, limpa obstáculos antigos da linha da nave que foram evitados na rodada anterior
-    for (int x = 0; x < 5; x++) {
-        if (space[4][x] == OBSTACLE && x != ship_pos) {
-            space[4][x] = EMPTY;
-        }
-    }
-
-    // Move os obstáculos de cima para baixo
-    for (int y = 5 - 2; y >= 0; y--) {
-        for (int x = 0; x < 5; x++) {
-            if (space[y][x] == OBSTACLE) {
-                // Verifica colisão com a nave
-                if (y + 1 == 4 && x == ship_pos) {
-                    play_denied_sound();
-                    collision = true;
-                }
-
-                // Move o obstáculo para baixo
-                space[y][x] = EMPTY;
-                space[y + 1][x] = OBSTACLE;
-            }
-        }
+    // Obstáculos evitados na linha da nave saem do campo; só permanece o que
+    // já estiver sobre a nave. A colisão é um AND com a linha que acabou de chegar.
+    uint32_t ship_bit = 1u << ship_pos;
+    uint32_t arrived = playfield_advance(&space, ship_bit);
+    if (arrived & ship_bit) {
+        play_denied_sound();
+        collision = true;
     }
 }
 
 // Função para mover a nave com base na entrada do joystick
 void move_ship(uint16_t x) {
-    // Apaga nave da posição anterior
-    space[4][ship_pos] = EMPTY;
-
-    // Atualiza posição com base na entrada analógica
-    if (x < 2048 - MARGIN_OF_ERROR) {
-        if (ship_pos > 0) {
-            
-            if(space[4][ship_pos - 1] == 2){
-                collision = true; // Colisão com o obstáculo
-                play_denied_sound(); // Toca o som de colisão
-                return;
-            }
-            ship_pos--;
-        }
-        else {
-            if(space[4][4] == 2){
-                collision = true; // Colisão com o obstáculo
-                play_denied_sound(); // Toca o som de colisão
-                return;
-            }
-            ship_pos = 4; // Se a nave estiver na borda esquerda, volta para a direita
-        }
-        
-    } else if (x > 2048 + MARGIN_OF_ERROR) {
-        if(ship_pos < 4) {
-            if(space[4][ship_pos + 1] == 2){
-                collision = true; // Colisão com o obstáculo
-                play_denied_sound(); // Toca o som de colisão
-                return;
-            }
-            ship_pos++;
-        }
-        else {
-            if(space[4][0] == 2){
-                collision = true; // Colisão com o obstáculo
-                play_denied_sound(); // Toca o som de colisão
-                return;
-            }
-            ship_pos = 0; // Se a nave estiver na borda direita, volta para a esquerda
-        }
+    int target = ship_pos;
+
+    // Atualiza posição com base na entrada analógica (as bordas dão a volta)
+    if (x < 2048 - MARGIN_OF_ERROR)
+        target = (ship_pos > 0) ? ship_pos - 1 : PLAYFIELD_WIDTH - 1;
+    else if (x > 2048 + MARGIN_OF_ERROR)
+        target = (ship_pos < PLAYFIELD_WIDTH - 1) ? ship_pos + 1 : 0;
+
+    if (target != ship_pos && playfield_obstacle_at(&space, target, SHIP_ROW)) {
+        collision = true; // Colisão com o obstáculo
+        play_denied_sound(); // Toca o som de colisão
+        return;
     }
-
-    // Atualiza matriz
-    space[4][ship_pos] = SHIP;
+    ship_pos = target;
 }
 
 // Função para resetar a matriz de LEDs e a posição da nave
 void reset_space() {
-    for (int y = 0; y < 5; y++) {
-        for (int x = 0; x < 5; x++) {
-            space[y][x] = EMPTY;
+    playfield_clear(&space);
+    ship_pos = PLAYFIELD_WIDTH / 2; // Reseta a posição da nave
+}
+
+// Função para desenhar a matriz de LEDs a partir dos bitboards do campo de jogo
+void draw_matrix_from(const uint32_t rows[PLAYFIELD_HEIGHT], int ship) {
+    // Cores já convertidas para GRB uma vez por quadro; o fundo é preenchido de
+    // uma vez e só os bits ligados (obstáculos) e a nave são visitados
+    PROFILE_SCOPE(PROFILE_MATRIX);
+    uint32_t colors[3];
+    colors[EMPTY] = matrix_color(&matrix, COLOR_EMPTY);
+    colors[SHIP] = matrix_color(&matrix, COLOR_SHIP);
+    colors[OBSTACLE] = matrix_color(&matrix, COLOR_OBSTACLE);
+
+    matrix_fill(&matrix, colors[EMPTY]);
+    matrix_set_xy(&matrix, ship, SHIP_ROW, colors[SHIP]);
+    for (int y = 0; y < PLAYFIELD_HEIGHT; y++) {
+        for (uint32_t bits = rows[y]; bits; bits &= bits - 1) {
+            matrix_set_xy(&matrix, __builtin_ctz(bits), y, colors[OBSTACLE]);
         }
     }
-    ship_pos = 2; // Reseta a posição da nave
-    space[4][ship_pos] = SHIP; // Coloca a nave na posição inicial
+    matrix_show(&matrix);
 }
 
 // Função para desenhar a matriz de LEDs com base na matriz de jogo
 void draw_matrix() {
-    RGB pixels[NUM_PIXELS];
+    uint32_t rows[PLAYFIELD_HEIGHT];
+    playfield_copy_rows(&space, rows);
+    draw_matrix_from(rows, ship_pos);
+}
 
-    for (int i = 0; i < NUM_PIXELS; i++) {
-        int x = i % 5;
-        int y = i / 5;
-
-        if (space[y][x] == SHIP) {
-            pixels[i].R = 0;
-            pixels[i].G = 0;
-            pixels[i].B = 1;
-        } else if (space[y][x] == OBSTACLE) {
-            pixels[i].R = 1;
-            pixels[i].G = 0;
-            pixels[i].B = 0;
-        } else {
-            pixels[i].R = 0;
-            pixels[i].G = 0;
-            pixels[i].B = 0;
-        }
-    }
-    desenho_pio(pixels, pio, sm);
+// Função de callback para os botões (interrupção da PIO, só transições já
+// filtradas): apenas registra o evento para o laço principal
+void button_irq_handler(uint gpio, uint32_t events){
+    input_events_push(gpio, events);
 }
 
-// Função de callback para os botões
-void gpio_irq_handler(uint gpio, uint32_t events){
-    if (gpio == BUTTON_A_PIN){
-        if (debounce(&button_a_time) && start_game && collision){
+// Aplica as transições de estado de um botão pressionado
+// (também chamada pela reprodução, com os botões lidos do log)
+void apply_button(replay_button_t button){
+#if RECORD_INPUT
+    if (!replaying) replay_record_button(button);
+#endif
+    if (button == REPLAY_BUTTON_A){
+        if (start_game && collision){
             collision = false; // Reseta a colisão
             reset_space(); // Reseta a matriz de LEDs
             printf("\nGame Restarted!\n");
             printf("Avoid the obstacles!\n");
         }
     }
-    else if (gpio == BUTTON_B_PIN){
-        if (debounce(&button_b_time)){
-            clear_matrix();
-            ssd1306_fill(&ssd, false); // Limpa o display
-            ssd1306_send_data(&ssd); // Atualiza o display
-            printf("\nExiting...\n");
-            reset_usb_boot(0,0);
+    else if (button == REPLAY_BUTTON_B){
+        if (replaying){
+            replay_exit = true;
+            return;
         }
+#if RECORD_INPUT
+        replay_record_flush(); // O log termina completo antes do reset
+#endif
+#if RENDER_ON_CORE1
+        render_core_stop(); // Devolve os displays ao núcleo 0 antes de limpá-los
+#endif
+        clear_matrix();
+        ssd1306_scroll_stop(&ssd); // Para o fundo antes de limpar o painel
+        ssd1306_fill(&ssd, false); // Limpa o display
+        ssd1306_send_data(&ssd); // Atualiza o display
+#if SCOREBOARD_PANEL
+        ssd1306_fill(&scoreboard, false);
+        ssd1306_send_data(&scoreboard);
+#endif
+        printf("\nExiting...\n");
+        reset_usb_boot(0,0);
     }
-    else if (gpio == JOYSTICK_BUTTON_PIN){
-        if (debounce(&joystick_button_time) && !start_game){
+    else if (button == REPLAY_BUTTON_JOYSTICK){
+        if (!start_game){
             start_game = true; 
             printf("\nGame Started!\n");
         }
     }
 }
 
+// Aplica um evento de botão (fora da interrupção); as solturas são ignoradas
+void handle_button_event(const input_event_t *event){
+    if (!(event->edge & GPIO_IRQ_EDGE_FALL))
+        return;
+    if (event->pin == BUTTON_A_PIN)
+        apply_button(REPLAY_BUTTON_A);
+    else if (event->pin == BUTTON_B_PIN)
+        apply_button(REPLAY_BUTTON_B);
+    else if (event->pin == JOYSTICK_BUTTON_PIN)
+        apply_button(REPLAY_BUTTON_JOYSTICK);
+}
+
+// Esvazia a fila de eventos dos botões
+void process_input_events(){
+    input_event_t event;
+    while (input_events_pop(&event))
+        handle_button_event(&event);
+}
+
 // Inicializa todos os periféricos do sistema
 void init_all_hardware() {
     stdio_init_all();
@@ -411,37 +498,45 @@ void init_all_hardware() {
     init_leds();
     init_buttons();
     buzzer_init_all();
-    matrix_init();
-
-    // Configuração de interrupções dos botões
-    gpio_set_irq_enabled_with_callback(BUTTON_B_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
-    gpio_set_irq_enabled_with_callback(BUTTON_A_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
-    gpio_set_irq_enabled_with_callback(JOYSTICK_BUTTON_PIN, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
-
-    // Semente aleatória
-    srand(to_ms_since_boot(get_absolute_time()));
+    matrix_init(&matrix, pio0, WS2812_PIN);
+
+    // Botões amostrados e filtrados na PIO: a CPU só é interrompida nas transições reais
+    buttons_init(pio1, &button_irq_handler);
+    buttons_add(BUTTON_A_PIN, BUTTON_A_DEBOUNCE_US);
+    buttons_add(BUTTON_B_PIN, BUTTON_B_DEBOUNCE_US);
+    buttons_add(JOYSTICK_BUTTON_PIN, JOYSTICK_BUTTON_DEBOUNCE_US);
+
+    // Semente aleatória (gravada no início do log de entradas)
+    rng_state = to_ms_since_boot(get_absolute_time());
+#if RECORD_INPUT
+    replay_record_start(rng_state);
+#endif
     draw_matrix(); // Exibe estado inicial
 }
 
 // Atualiza lógica do jogo se não houve colisão
-void update_game_logic(uint16_t x_value, uint16_t y_value) {
+void update_game_logic(uint16_t x_value) {
     score += 10;
     move_obstacles();
     generate_obstacle();
     
     if (!collision)
         move_ship(x_value);
-
-    draw_matrix();
-    
 }
 
 // Lida com colisão (reset de variáveis)
 void handle_collision() {
     printf("\nGame Over! Score: %d\n", score);
     printf("Press A to restart or B to exit.\n");
+    printf("Input events dropped: %lu, worst latency: %lu us, button IRQs: %lu\n",
+           (unsigned long)input_events_dropped(), (unsigned long)input_events_max_latency_us(),
+           (unsigned long)buttons_interrupts());
     score = 0;
     delay = 300;
+    if (simulation_task) scheduler_set_period(simulation_task, delay * 1000);
+#if RECORD_INPUT
+    if (!replaying) replay_record_flush(); // Partida completa no log
+#endif
 }
 
 // Verifica e ajusta a progressão do jogo
@@ -451,6 +546,7 @@ void check_score_progression() {
         printf("\nCongratulations! Score: %d\n", score);
         printf("The game is getting faster!\n");
         if (delay > 100) delay -= 50; // Limita para não ficar muito rápido
+        if (simulation_task) scheduler_set_period(simulation_task, delay * 1000);
     }
 }
 
@@ -458,36 +554,150 @@ void check_score_progression() {
 void start_display(ssd1306_t *ssd){
     ssd1306_fill(ssd, true); // Limpa o display
     ssd1306_rect(ssd, 3, 3, 122, 58, false, true); // Desenha um retângulo
-    ssd1306_draw_string(ssd, "SPACEFIGHT", 20, 10); // Desenha uma string
-    ssd1306_draw_string(ssd, "Avoid the", 25, 30); // Desenha uma string
-    ssd1306_draw_string(ssd, "obstacles", 25, 48); // Desenha uma string      
+    ssd1306_draw_string_cached(ssd, "SPACEFIGHT", 20, 10); // Desenha uma string
+    ssd1306_draw_string_cached(ssd, "Avoid the", 25, 30); // Desenha uma string
+    ssd1306_draw_string_cached(ssd, "obstacles", 25, 48); // Desenha uma string
     ssd1306_send_data(ssd); // Atualiza o display
 }
 
+// Tarefa de entrada: trata os botões e filtra o joystick a cada milissegundo
+void input_task() {
+    PROFILE_SCOPE(PROFILE_INPUT);
+    process_input_events();
+    joystick_update();
+}
+
+void publish_task();
+
+// Um passo do jogo a partir da leitura filtrada do eixo X do joystick (o Y
+// é gravado no replay, mas o jogo não o usa)
+void game_step(uint16_t x_value) {
+    if (!collision)
+        update_game_logic(x_value);
+    else if(collision && score != 0)
+        handle_collision();
+    check_score_progression();
+}
+
+// Tarefa de simulação: um passo do jogo a cada delay ms
+void simulation_task_run() {
+    PROFILE_SCOPE(PROFILE_LOGIC);
+    joystick_state_t joystick = joystick_get_filtered();
+#if RECORD_INPUT
+    replay_record_tick(joystick.x, joystick.y);
+#endif
+    game_step(joystick.x);
+#if RENDER_ON_CORE1
+    publish_task(); // Entrega o passo recém-simulado sem aguardar o próximo período
+#endif
+}
+
+// Copia o estado atual do jogo para um snapshot imutável
+void capture_snapshot(game_snapshot_t *snapshot) {
+    playfield_copy_rows(&space, snapshot->rows);
+    snapshot->ship_pos = ship_pos;
+    snapshot->score = score;
+    snapshot->speed = (300 - delay) / 50 + 1;
+    snapshot->collision = collision;
+}
+
+// Tarefa de publicação: entrega o estado mais recente ao núcleo 1 sem esperar
+void publish_task() {
+    game_snapshot_t snapshot;
+    capture_snapshot(&snapshot);
+    render_core_publish(&snapshot);
+}
+
+// Renderizador do núcleo 1: dono do OLED e da matriz, desenha sempre o snapshot mais novo
+void render_snapshot(const game_snapshot_t *snapshot) {
+    oled_render(&ssd, snapshot);
+    draw_matrix_from(snapshot->rows, snapshot->ship_pos);
+    PROFILE_FRAME_END();
+}
+
+// Ao parar o núcleo 1: espera os quadros em trânsito nos displays
+void render_drain(void) {
+    ssd1306_send_wait(&ssd);
+#if SCOREBOARD_PANEL
+    ssd1306_send_wait(&scoreboard);
+#endif
+    matrix_wait(&matrix);
+}
+
+// Tarefa do display OLED
+void oled_task() {
+    game_snapshot_t snapshot;
+    capture_snapshot(&snapshot);
+    oled_render(&ssd, &snapshot);
+    PROFILE_FRAME_END();
+}
+
+// Tarefa da matriz de LEDs
+void matrix_task() {
+    draw_matrix();
+}
+
+// Reprodução headless: aplica um log gravado à lógica do jogo o mais rápido
+// possível, sem dormir nem desenhar. Retorna o número de passos executados
+// ou -1 se o log for inválido.
+int32_t replay_game(const uint8_t *log, size_t len) {
+    replay_reader_t reader;
+    replay_entry_t entry;
+    if (!replay_open(&reader, log, len))
+        return -1;
+
+    replaying = true;
+    replay_exit = false;
+    rng_state = reader.seed;
+    start_game = false;
+    collision = false;
+    score = 0;
+    delay = 300;
+    reset_space();
+
+    int32_t steps = 0;
+    while (!replay_exit && replay_next(&reader, &entry)) {
+        for (uint i = 0; i < entry.button_count; i++)
+            apply_button(entry.buttons[i]);
+        if (entry.step && !replay_exit) {
+            game_step(entry.x);
+            steps++;
+        }
+    }
+    replaying = false;
+    return steps;
+}
+
 // Função principal
 int main() {
     init_all_hardware();
     printf("\nAvoid the obstacles!\n");
 
     start_display(&ssd); 
-    while (start_game == false)  // Aguarda o início do jogo
+    ssd1306_scroll_horizontal(&ssd, true, 1, 2, SSD1306_SCROLL_5_FRAMES); // Título corre sozinho no painel
+    while (start_game == false) { // Aguarda o início do jogo
+        process_input_events();
         sleep_ms(50); // Delay para evitar leitura excessiva
-    
-    while (true) {
-        // Leitura do joystick
-        adc_select_input(1);
-        uint16_t x_value = adc_read();
-        adc_select_input(0);
-        uint16_t y_value = adc_read();
-
-        if (!collision)
-            update_game_logic(x_value, y_value);
-        else if(collision && score != 0)
-            handle_collision();
-        joystic_movimentation(&ssd, x_value, y_value);
-        check_score_progression();
-        sleep_ms(delay);
     }
+    ssd1306_scroll_stop(&ssd);
+    oled_layout(&ssd); // Tela do jogo montada antes de o OLED passar ao renderizador
+
+    // Cada subsistema roda no seu próprio ritmo, em alarmes de hardware
+    scheduler_add("input", input_task, INPUT_PERIOD_US);
+    simulation_task = scheduler_add("simulation", simulation_task_run, delay * 1000);
+#if RENDER_ON_CORE1
+    // Os displays passam para o núcleo 1; o núcleo 0 nunca espera pelo barramento
+    ssd1306_send_wait(&ssd);
+    render_core_start(render_snapshot, render_drain);
+    scheduler_add("publish", publish_task, PUBLISH_PERIOD_US);
+#else
+    scheduler_add("oled", oled_task, OLED_PERIOD_US);
+    scheduler_add("matrix", matrix_task, MATRIX_PERIOD_US);
+#endif
+#if PROFILER_ENABLED
+    scheduler_add("telemetry", profiler_telemetry_task, 1000000 / PROFILER_TELEMETRY_HZ);
+#endif
+    scheduler_run();
 
     return 0;
 }
@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "bench_clock.h"
+#include "ssd1306.h"
+#include "matrix.h"
+#include "profiler.h"
+#include "entities.h"
+#include "game_state.h"
+
+// Microbenchmarks das primitivas de desenho e do passo do jogo. Cada caso
+// roda BENCH_WARMUP amostras descartadas e BENCH_SAMPLES amostras medidas;
+// cada amostra cronometra um lote de chamadas e vira ns por chamada.
+// Saída em CSV: name,samples,batch,min_ns,median_ns,p99_ns,bytes,bus_us
+//
+// O mesmo código roda no RP2040 (SysTick, CSV pela USB) e no host
+// (CLOCK_MONOTONIC), contra o firmware real compilado em bench_firmware.c.
+
+#define BENCH_WARMUP 16
+#define BENCH_SAMPLES 200
+
+// Estado e funções do firmware (ProjetoIntegrado.c)
+extern ssd1306_t ssd;
+extern matrix_t matrix;
+extern volatile bool collision;
+extern int ship_pos;
+void init_all_hardware();
+uint32_t matrix_rgb(uint8_t r, uint8_t g, uint8_t b);
+void desenho_pio(RGB pixels[MATRIX_NUM_PIXELS]);
+void draw_matrix();
+void generate_obstacle();
+void move_obstacles();
+void move_ship(uint16_t x);
+void reset_space();
+void update_game_logic(uint16_t x_value);
+
+typedef struct {
+  const char *name;
+  void (*setup)(void);              // Fora do tempo medido
+  void (*run)(void);
+  uint batch;                       // Chamadas por amostra
+  bool bus;                         // Registra bytes e tempo de barramento
+} bench_case_t;
+
+static uint32_t samples[BENCH_SAMPLES];
+static volatile uint32_t sink;      // Impede que o compilador descarte resultados
+static uint bench_iteration;
+
+// ---------------------------------------------------------------- casos
+static void bench_fill(void) {
+  ssd1306_fill(&ssd, bench_iteration++ & 1);
+}
+
+static void bench_rect(void) {
+  ssd1306_rect(&ssd, 3, 3, 122, 58, true, false);
+  ssd1306_rect(&ssd, 20, 40, 8, 8, true, true);
+}
+
+static void bench_line(void) {
+  ssd1306_line(&ssd, 0, 0, 127, 63, true);
+}
+
+static void bench_draw_string(void) {
+  ssd1306_draw_string(&ssd, "SPACEFIGHT", 20, 10);
+}
+
+static void setup_full_frame(void) {
+  ssd1306_send_wait(&ssd);
+  ssd1306_fill(&ssd, bench_iteration++ & 1);
+}
+
+static void setup_square(void) {
+  ssd1306_send_wait(&ssd);
+  ssd1306_rect(&ssd, 20, bench_iteration++ & 63, 8, 8, true, true);
+}
+
+static void bench_send_data(void) {
+  ssd1306_send_data(&ssd);
+}
+
+static void bench_matrix_rgb(void) {
+  sink += matrix_rgb(bench_iteration & 0xFF, 0x40, 0x80);
+  bench_iteration++;
+}
+
+static void bench_desenho_pio(void) {
+  static RGB pixels[MATRIX_NUM_PIXELS];
+  pixels[bench_iteration++ % MATRIX_NUM_PIXELS].R ^= 0xFF;
+  desenho_pio(pixels);
+}
+
+static void setup_playfield(void) {
+  reset_space();
+  collision = false;
+  for (uint i = 0; i < 3; ++i) {
+    generate_obstacle();
+    move_obstacles();
+  }
+  collision = false;
+}
+
+static void bench_draw_matrix(void) {
+  draw_matrix();
+}
+
+static void bench_move_obstacles(void) {
+  move_obstacles();
+  generate_obstacle();
+}
+
+static void bench_move_ship(void) {
+  move_ship(bench_iteration++ & 1 ? 400 : 3700);
+}
+
+static void bench_update_game_logic(void) {
+  collision = false;
+  update_game_logic(bench_iteration++ & 1 ? 400 : 3700);
+}
+
+// Modo de alta resolução: 500 entidades vivas espalhadas pela tela
+#define BENCH_ENTITIES 500
+
+static entity_world_t world;
+
+static void setup_entities(void) {
+  uint32_t state = 0xE7717E5;
+  entities_init(&world);
+  for (uint i = 0; i < BENCH_ENTITIES; ++i) {
+    int16_t x = game_rand(&state) % ENTITY_PX(ENTITY_FIELD_WIDTH);
+    int16_t y = game_rand(&state) % ENTITY_PX(ENTITY_FIELD_HEIGHT);
+    if (i % 8 == 0)
+      entities_spawn(&world, ENTITY_PROJECTILE, x, y, 0, -ENTITY_PX(2), 0);
+    else if (i % 8 == 1)
+      entities_spawn(&world, ENTITY_PARTICLE, x, y, game_rand(&state) % 33 - 16, game_rand(&state) % 33 - 16, 200);
+    else
+      entities_spawn(&world, ENTITY_OBSTACLE, x, y, 0, 8 + game_rand(&state) % 9, 0);
+  }
+}
+
+static void setup_entities_grid(void) {
+  setup_entities();
+  entities_update(&world);
+}
+
+static void bench_entities_update(void) {
+  sink += entities_update(&world);
+}
+
+// Projéteis contra obstáculos e a nave contra obstáculos, pela grade
+static void bench_entities_collide(void) {
+  sink += entities_collide_projectiles(&world);
+  sink += entities_query(&world, ENTITY_PX(60), ENTITY_PX(56), ENTITY_PX(8), ENTITY_PX(6));
+}
+
+#if PROFILER_ENABLED
+// Toda a instrumentação de um quadro: as seis zonas, os dois barramentos e o
+// fechamento do registro (o orçamento é 1% de um quadro de 16,7 ms)
+static void bench_profiler_frame(void) {
+  for (int zone = 0; zone < PROFILE_ZONES; zone++) {
+    PROFILE_SCOPE(zone);
+    sink++;
+  }
+  PROFILE_BUS_BEGIN(PROFILE_BUS_I2C);
+  PROFILE_BUS_END(PROFILE_BUS_I2C);
+  PROFILE_BUS_ADD(PROFILE_BUS_PIO, 900);
+  PROFILE_FRAME_END();
+}
+#endif
+
+static const bench_case_t cases[] = {
+  {"ssd1306_fill", NULL, bench_fill, 16, false},
+  {"ssd1306_rect", NULL, bench_rect, 16, false},
+  {"ssd1306_line", NULL, bench_line, 16, false},
+  {"ssd1306_draw_string", NULL, bench_draw_string, 16, false},
+  {"ssd1306_send_data_full", setup_full_frame, bench_send_data, 1, true},
+  {"ssd1306_send_data_square", setup_square, bench_send_data, 1, true},
+  {"matrix_rgb", NULL, bench_matrix_rgb, 64, false},
+  {"desenho_pio", NULL, bench_desenho_pio, 1, false},
+  {"draw_matrix", setup_playfield, bench_draw_matrix, 1, false},
+  {"move_obstacles", setup_playfield, bench_move_obstacles, 8, false},
+  {"move_ship", setup_playfield, bench_move_ship, 8, false},
+  {"update_game_logic", setup_playfield, bench_update_game_logic, 8, false},
+  {"entities_update_500", setup_entities, bench_entities_update, 1, false},
+  {"entities_collide_500", setup_entities_grid, bench_entities_collide, 1, false},
+#if PROFILER_ENABLED
+  {"profiler_frame", NULL, bench_profiler_frame, 8, false},
+#endif
+};
+
+// ---------------------------------------------------------------- medição
+static int compare_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return x < y ? -1 : x > y;
+}
+
+static void bench_run_case(const bench_case_t *c) {
+  uint64_t bus_us = 0;
+  uint32_t bytes = 0;
+
+  for (uint s = 0; s < BENCH_WARMUP + BENCH_SAMPLES; ++s) {
+    if (c->setup)
+      c->setup();
+    uint64_t bus_start = time_us_64();
+    bench_ticks_t start = bench_ticks();
+    for (uint i = 0; i < c->batch; ++i)
+      c->run();
+    bench_ticks_t end = bench_ticks();
+    uint64_t bus_end = time_us_64();
+
+    if (s < BENCH_WARMUP)
+      continue;
+    samples[s - BENCH_WARMUP] = bench_elapsed_ns(start, end) / c->batch;
+    if (c->bus) {
+      bus_us += bus_end - bus_start;
+      bytes += ssd.frame_bytes;
+    }
+  }
+
+  qsort(samples, BENCH_SAMPLES, sizeof(samples[0]), compare_u32);
+  printf("%s,%u,%u,%lu,%lu,%lu,%lu,%lu\n", c->name, BENCH_SAMPLES, c->batch,
+         (unsigned long) samples[0],
+         (unsigned long) samples[BENCH_SAMPLES / 2],
+         (unsigned long) samples[BENCH_SAMPLES * 99 / 100],
+         (unsigned long) (c->bus ? bytes / BENCH_SAMPLES : 0),
+         (unsigned long) (c->bus ? bus_us / BENCH_SAMPLES : 0));
+}
+
+int main() {
+  init_all_hardware();
+  bench_clock_init();
+#ifndef BENCH_HOST
+  sleep_ms(3000); // Tempo para o terminal USB conectar
+#endif
+
+  printf("name,samples,batch,min_ns,median_ns,p99_ns,bytes,bus_us\n");
+  for (uint i = 0; i < count_of(cases); ++i)
+    bench_run_case(&cases[i]);
+  printf("# done\n");
+
+#ifndef BENCH_HOST
+  while (true)
+    sleep_ms(1000);
+#endif
+  return 0;
+}
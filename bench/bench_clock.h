@@ -0,0 +1,52 @@
+#ifndef BENCH_CLOCK_H
+#define BENCH_CLOCK_H
+
+#include "pico/stdlib.h"
+
+// Relógio de alta resolução do benchmark: ciclos do SysTick no RP2040 (contador
+// decrescente de 24 bits a clk_sys) e CLOCK_MONOTONIC no host
+
+#ifdef BENCH_HOST
+#include <time.h>
+
+typedef uint64_t bench_ticks_t;
+
+static inline void bench_clock_init(void) {
+}
+
+static inline bench_ticks_t bench_ticks(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static inline uint64_t bench_elapsed_ns(bench_ticks_t start, bench_ticks_t end) {
+  return end - start;
+}
+
+#else
+#include "hardware/structs/systick.h"
+#include "hardware/clocks.h"
+
+#define BENCH_SYSTICK_MASK 0x00FFFFFFu
+
+typedef uint32_t bench_ticks_t;
+
+// Fonte = clock do processador, sem interrupção; dá a volta em ~134 ms a 125 MHz
+static inline void bench_clock_init(void) {
+  systick_hw->rvr = BENCH_SYSTICK_MASK;
+  systick_hw->cvr = 0;
+  systick_hw->csr = 0x5;
+}
+
+static inline bench_ticks_t bench_ticks(void) {
+  return systick_hw->cvr;
+}
+
+static inline uint64_t bench_elapsed_ns(bench_ticks_t start, bench_ticks_t end) {
+  uint32_t cycles = (start - end) & BENCH_SYSTICK_MASK;
+  return (uint64_t) cycles * 1000000000u / clock_get_hz(clk_sys);
+}
+#endif
+
+#endif
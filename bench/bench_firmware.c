@@ -0,0 +1,4 @@
+// O firmware inteiro entra no benchmark; o main dele é renomeado para que
+// bench.c chame as funções do jogo diretamente
+#define main firmware_main
+#include "../ProjetoIntegrado.c"
@@ -0,0 +1,96 @@
+#include "host_hal.h"
+#include "hardware/adc.h"
+
+// ADC com entradas roteirizadas: cada conversão pede o valor da fonte no
+// instante atual. O round-robin e o divisor seguem o comportamento do RP2040
+// (uma conversão a cada 1 + div ciclos de 48 MHz, mínimo de 96).
+
+#define ADC_CLOCK_HZ 48000000
+#define ADC_MIN_CYCLES 96
+
+static adc_hw_t adc_regs;
+adc_hw_t *adc_hw = &adc_regs;
+
+static uint selected;
+static uint round_robin;
+static float clkdiv;
+
+static uint16_t adc_default_source(uint input, uint64_t now_us) {
+  (void) input; (void) now_us;
+  return 2048;
+}
+
+static host_adc_source_t source = adc_default_source;
+
+void host_adc_set_source(host_adc_source_t new_source) {
+  source = new_source ? new_source : adc_default_source;
+}
+
+static uint16_t adc_convert(void) {
+  uint16_t value = source(selected, host_now_ns() / 1000) & 0xFFF;
+  if (round_robin) {
+    do {
+      selected = (selected + 1) % 5;
+    } while (!(round_robin & (1u << selected)));
+  }
+  return value;
+}
+
+bool host_adc_is_fifo(uintptr_t addr) {
+  return addr == (uintptr_t) &adc_regs.fifo;
+}
+
+uint16_t host_adc_fifo_pop(void) {
+  return adc_convert();
+}
+
+uint64_t host_adc_sample_ns(void) {
+  float cycles = 1.0f + clkdiv;
+  if (cycles < ADC_MIN_CYCLES)
+    cycles = ADC_MIN_CYCLES;
+  return (uint64_t) (cycles * 1e9f / ADC_CLOCK_HZ);
+}
+
+void adc_init(void) {
+  adc_regs.cs = 1;
+}
+
+void adc_gpio_init(uint gpio) {
+  (void) gpio;
+}
+
+void adc_select_input(uint input) {
+  selected = input;
+}
+
+uint adc_get_selected_input(void) {
+  return selected;
+}
+
+void adc_set_round_robin(uint input_mask) {
+  round_robin = input_mask;
+}
+
+void adc_set_clkdiv(float div) {
+  clkdiv = div;
+}
+
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift) {
+  adc_regs.fcs = (en ? 1u : 0u) | (dreq_en ? 8u : 0u) | ((uint32_t) dreq_thresh << 24);
+  (void) err_in_fifo; (void) byte_shift;
+}
+
+void adc_fifo_drain(void) {
+}
+
+void adc_run(bool run) {
+  if (run)
+    adc_regs.cs |= 8u;
+  else
+    adc_regs.cs &= ~8u;
+}
+
+uint16_t adc_read(void) {
+  host_advance_ns(host_adc_sample_ns());
+  return adc_convert();
+}
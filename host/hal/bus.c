@@ -0,0 +1,25 @@
+#include "host_hal.h"
+#include <string.h>
+
+// Acesso do DMA a um endereço: registradores com efeito colateral vão para o
+// modelo correspondente; o resto é memória comum
+
+uint32_t host_bus_read(uintptr_t addr, uint size) {
+  if (host_adc_is_fifo(addr))
+    return host_adc_fifo_pop();
+
+  uint32_t value = 0;
+  memcpy(&value, (const void *) addr, size);
+  return value;
+}
+
+void host_bus_write(uintptr_t addr, uint32_t value, uint size) {
+  if (host_i2c_is_data_cmd(addr))
+    host_i2c_write_word(addr, value);
+  else if (host_pio_is_txf(addr))
+    host_pio_write_txf(addr, value);
+  else if (host_dma_is_register(addr))
+    host_dma_write_register(addr, value);
+  else
+    memcpy((void *) addr, &value, size);
+}
@@ -0,0 +1,231 @@
+#include "host_hal.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+// Relógio virtual em nanossegundos. O tempo só anda quando o firmware espera
+// (sleep, __wfe, espera ativa); ao andar, os eventos vencidos de cada fonte
+// (alarmes, DMA, roteiro de entradas) são executados em ordem, como
+// interrupções.
+
+#define HOST_MAX_SOURCES 8
+#define HOST_MAX_ALARMS 16
+
+static uint64_t now_ns = 0;
+static uint64_t limit_ns = UINT64_MAX;
+static int dispatch_depth = 0;
+static host_exit_fn_t exit_handler;
+
+static const host_event_source_t *sources[HOST_MAX_SOURCES];
+static uint source_count = 0;
+
+typedef struct {
+  bool active;
+  uint64_t target_us;
+  alarm_callback_t callback;
+  void *user_data;
+} host_alarm_t;
+
+static host_alarm_t alarms[HOST_MAX_ALARMS];
+
+uint64_t host_now_ns(void) {
+  return now_ns;
+}
+
+void host_set_time_limit_us(uint64_t limit_us) {
+  limit_ns = limit_us * 1000;
+}
+
+void host_set_exit_handler(host_exit_fn_t handler) {
+  exit_handler = handler;
+}
+
+void host_exit(const char *reason) {
+  if (exit_handler)
+    exit_handler(reason);
+  exit(0);
+}
+
+void host_register_source(const host_event_source_t *source) {
+  if (source_count < HOST_MAX_SOURCES)
+    sources[source_count++] = source;
+}
+
+// ---------------------------------------------------------------- alarmes
+static uint64_t alarm_next(void) {
+  uint64_t next = UINT64_MAX;
+  for (uint i = 0; i < HOST_MAX_ALARMS; ++i)
+    if (alarms[i].active && alarms[i].target_us * 1000 < next)
+      next = alarms[i].target_us * 1000;
+  return next;
+}
+
+static void alarm_run(uint64_t now) {
+  while (true) {
+    host_alarm_t *due = NULL;
+    for (uint i = 0; i < HOST_MAX_ALARMS; ++i) {
+      host_alarm_t *alarm = &alarms[i];
+      if (alarm->active && alarm->target_us * 1000 <= now && (!due || alarm->target_us < due->target_us))
+        due = alarm;
+    }
+    if (!due)
+      return;
+
+    // Mesma semântica do SDK: < 0 reagenda a partir do alvo anterior,
+    // > 0 a partir de agora, 0 encerra o alarme
+    int64_t ret = due->callback((alarm_id_t) (due - alarms) + 1, due->user_data);
+    if (ret < 0)
+      due->target_us += (uint64_t) -ret;
+    else if (ret > 0)
+      due->target_us = now / 1000 + (uint64_t) ret;
+    else
+      due->active = false;
+  }
+}
+
+static const host_event_source_t alarm_source = {alarm_next, alarm_run};
+
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+  static bool registered = false;
+  if (!registered) {
+    host_register_source(&alarm_source);
+    registered = true;
+  }
+  if (!fire_if_past && time_reached(time))
+    return 0;
+  for (uint i = 0; i < HOST_MAX_ALARMS; ++i) {
+    if (!alarms[i].active) {
+      alarms[i].active = true;
+      alarms[i].target_us = time;
+      alarms[i].callback = callback;
+      alarms[i].user_data = user_data;
+      return (alarm_id_t) i + 1;
+    }
+  }
+  return -1;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+  return add_alarm_at(make_timeout_time_us(us), callback, user_data, fire_if_past);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+  return add_alarm_in_us((uint64_t) ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id) {
+  if (alarm_id <= 0 || alarm_id > HOST_MAX_ALARMS || !alarms[alarm_id - 1].active)
+    return false;
+  alarms[alarm_id - 1].active = false;
+  return true;
+}
+
+// ---------------------------------------------------------------- avanço
+static uint64_t next_event_ns(void) {
+  uint64_t next = UINT64_MAX;
+  for (uint i = 0; i < source_count; ++i) {
+    uint64_t t = sources[i]->next();
+    if (t < next)
+      next = t;
+  }
+  return next;
+}
+
+static void set_now(uint64_t t) {
+  if (t > now_ns)
+    now_ns = t;
+  if (now_ns >= limit_ns)
+    host_exit("time limit");
+}
+
+// Avança até deadline executando os eventos no caminho. Dentro de um
+// tratador de evento (interrupção) o tempo anda, mas nada novo é despachado.
+void host_advance_to_ns(uint64_t deadline) {
+  if (dispatch_depth) {
+    set_now(deadline);
+    return;
+  }
+  dispatch_depth++;
+  while (true) {
+    uint64_t next = next_event_ns();
+    if (next > deadline)
+      break;
+    set_now(next);
+    for (uint i = 0; i < source_count; ++i)
+      sources[i]->run(now_ns);
+  }
+  set_now(deadline);
+  dispatch_depth--;
+}
+
+void host_advance_ns(uint64_t ns) {
+  host_advance_to_ns(now_ns + ns);
+}
+
+// Dorme até o próximo evento de qualquer fonte
+void host_wait_for_event(void) {
+  uint64_t next = next_event_ns();
+  if (next == UINT64_MAX)
+    host_exit("no pending events");
+  host_advance_to_ns(next < now_ns ? now_ns : next);
+}
+
+void __wfe(void) {
+  host_wait_for_event();
+}
+
+void __wfi(void) {
+  host_wait_for_event();
+}
+
+void tight_loop_contents(void) {
+  host_advance_ns(HOST_POLL_NS);
+}
+
+// ---------------------------------------------------------------- pico/time
+absolute_time_t get_absolute_time(void) {
+  return now_ns / 1000;
+}
+
+uint64_t time_us_64(void) {
+  return now_ns / 1000;
+}
+
+uint32_t time_us_32(void) {
+  return (uint32_t) (now_ns / 1000);
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t) {
+  return (uint32_t) (t / 1000);
+}
+
+uint64_t to_us_since_boot(absolute_time_t t) {
+  return t;
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us) {
+  return now_ns / 1000 + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms) {
+  return now_ns / 1000 + (uint64_t) ms * 1000;
+}
+
+absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) {
+  return t + us;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+  return (int64_t) (to - from);
+}
+
+bool time_reached(absolute_time_t t) {
+  return now_ns / 1000 >= t;
+}
+
+void sleep_us(uint64_t us) {
+  host_advance_ns(us * 1000);
+}
+
+void sleep_ms(uint32_t ms) {
+  host_advance_ns((uint64_t) ms * 1000000);
+}
@@ -0,0 +1,309 @@
+#include "host_hal.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include <string.h>
+
+// Modelo do DMA: cada canal ativo move um elemento por vez no ritmo do seu
+// DREQ (I2C, PIO, ADC, temporizador ou imediato). Ao terminar, sinaliza a
+// IRQ 0 e dispara o canal encadeado, como no RP2040.
+
+#define PIO_WORD_NS 30000           // 24 bits a 800 kHz por palavra do WS2812
+
+typedef struct {
+  bool claimed;
+  bool busy;
+  dma_channel_config config;
+  uint32_t reload;                  // Último valor escrito em TRANS_COUNT
+  uint64_t next_ns;                 // Próximo elemento
+} host_dma_channel_t;
+
+typedef struct {
+  bool claimed;
+  uint16_t numerator;
+  uint16_t denominator;
+} host_dma_timer_t;
+
+static dma_channel_hw_t regs[NUM_DMA_CHANNELS];
+static host_dma_channel_t channels[NUM_DMA_CHANNELS];
+static host_dma_timer_t timers[NUM_DMA_TIMERS];
+static uint32_t inte0;
+static uint32_t ints0;
+
+static uint64_t dma_next(void);
+static void dma_run(uint64_t now);
+static const host_event_source_t dma_source = {dma_next, dma_run};
+
+// Intervalo entre elementos para o DREQ do canal
+static uint64_t dma_element_ns(uint dreq) {
+  if (dreq == DREQ_FORCE)
+    return 0;
+  if (dreq >= DREQ_DMA_TIMER0 && dreq <= DREQ_DMA_TIMER3) {
+    host_dma_timer_t *timer = &timers[dreq - DREQ_DMA_TIMER0];
+    if (!timer->numerator)
+      return UINT64_MAX;
+    return (uint64_t) 1000000000 * timer->denominator / ((uint64_t) clock_get_hz(clk_sys) * timer->numerator);
+  }
+  if (dreq == DREQ_ADC)
+    return host_adc_sample_ns();
+  if (dreq >= DREQ_I2C0_TX && dreq <= DREQ_I2C1_RX)
+    return host_i2c_word_ns(dreq);
+  if ((dreq & 7) < 4 && dreq < DREQ_I2C0_TX)
+    return PIO_WORD_NS;
+  return 0;
+}
+
+// FIFOs de saída começam vazias: o primeiro elemento sai na hora.
+// Fontes de amostras (ADC, temporizador) esperam um período.
+static bool dma_paced_source(uint dreq) {
+  return dreq == DREQ_ADC || (dreq >= DREQ_DMA_TIMER0 && dreq <= DREQ_DMA_TIMER3);
+}
+
+static void dma_trigger(uint channel) {
+  static bool registered = false;
+  if (!registered) {
+    host_register_source(&dma_source);
+    registered = true;
+  }
+  host_dma_channel_t *ch = &channels[channel];
+  regs[channel].transfer_count = ch->reload;
+  ch->busy = true;
+  ch->next_ns = host_now_ns();
+  if (dma_paced_source(ch->config.dreq)) {
+    uint64_t step = dma_element_ns(ch->config.dreq);
+    ch->next_ns = step == UINT64_MAX ? UINT64_MAX : ch->next_ns + step;
+  }
+}
+
+static void dma_complete(uint channel) {
+  host_dma_channel_t *ch = &channels[channel];
+  ch->busy = false;
+  // O encadeamento acontece no hardware antes de o tratador da IRQ rodar
+  if (ch->config.chain_to != channel)
+    dma_trigger(ch->config.chain_to);
+  if (inte0 & (1u << channel)) {
+    ints0 |= 1u << channel;
+    host_irq_raise(DMA_IRQ_0);
+  }
+}
+
+static uintptr_t dma_step_addr(uintptr_t addr, uint size, bool ring, uint ring_bits) {
+  if (!ring || !ring_bits)
+    return addr + size;
+  uintptr_t mask = ((uintptr_t) 1 << ring_bits) - 1;
+  return (addr & ~mask) | ((addr + size) & mask);
+}
+
+static void dma_transfer_element(uint channel) {
+  host_dma_channel_t *ch = &channels[channel];
+  dma_channel_hw_t *hw = &regs[channel];
+  uint size = 1u << ch->config.size;
+
+  uint32_t value = host_bus_read(hw->read_addr, size);
+  host_bus_write(hw->write_addr, value, size);
+
+  if (ch->config.read_increment)
+    hw->read_addr = dma_step_addr(hw->read_addr, size, !ch->config.ring_write, ch->config.ring_bits);
+  if (ch->config.write_increment)
+    hw->write_addr = dma_step_addr(hw->write_addr, size, ch->config.ring_write, ch->config.ring_bits);
+  hw->transfer_count--;
+}
+
+static uint64_t dma_next(void) {
+  uint64_t next = UINT64_MAX;
+  for (uint i = 0; i < NUM_DMA_CHANNELS; ++i)
+    if (channels[i].busy && channels[i].next_ns < next)
+      next = channels[i].next_ns;
+  return next;
+}
+
+static void dma_run(uint64_t now) {
+  while (true) {
+    int due = -1;
+    for (uint i = 0; i < NUM_DMA_CHANNELS; ++i)
+      if (channels[i].busy && channels[i].next_ns <= now && (due < 0 || channels[i].next_ns < channels[due].next_ns))
+        due = i;
+    if (due < 0)
+      return;
+
+    host_dma_channel_t *ch = &channels[due];
+    if (regs[due].transfer_count)
+      dma_transfer_element(due);
+    if (!regs[due].transfer_count) {
+      dma_complete(due);
+    } else {
+      uint64_t step = dma_element_ns(ch->config.dreq);
+      ch->next_ns = step == UINT64_MAX ? UINT64_MAX : ch->next_ns + step;
+    }
+  }
+}
+
+// ---------------------------------------------------------------- registradores
+bool host_dma_is_register(uintptr_t addr) {
+  return addr >= (uintptr_t) regs && addr < (uintptr_t) (regs + NUM_DMA_CHANNELS);
+}
+
+void host_dma_write_register(uintptr_t addr, uint32_t value) {
+  uint channel = (addr - (uintptr_t) regs) / sizeof(dma_channel_hw_t);
+  uint field = (addr - (uintptr_t) &regs[channel]) / sizeof(uintptr_t);
+  switch (field) {
+    case 0: case 5: regs[channel].read_addr = value; break;
+    case 1: case 6: regs[channel].write_addr = value; break;
+    case 2: channels[channel].reload = value; break;
+    case 3: dma_trigger(channel); break;
+    case 7:
+      channels[channel].reload = value;
+      dma_trigger(channel);
+      break;
+    default: break;
+  }
+}
+
+// ---------------------------------------------------------------- API do SDK
+int dma_claim_unused_channel(bool required) {
+  for (uint i = 0; i < NUM_DMA_CHANNELS; ++i) {
+    if (!channels[i].claimed) {
+      channels[i].claimed = true;
+      return i;
+    }
+  }
+  if (required)
+    host_exit("no free DMA channel");
+  return -1;
+}
+
+void dma_channel_unclaim(uint channel) {
+  channels[channel].claimed = false;
+}
+
+int dma_claim_unused_timer(bool required) {
+  for (uint i = 0; i < NUM_DMA_TIMERS; ++i) {
+    if (!timers[i].claimed) {
+      timers[i].claimed = true;
+      return i;
+    }
+  }
+  if (required)
+    host_exit("no free DMA timer");
+  return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+  dma_channel_config c;
+  memset(&c, 0, sizeof(c));
+  c.size = DMA_SIZE_32;
+  c.read_increment = true;
+  c.write_increment = false;
+  c.dreq = DREQ_FORCE;
+  c.chain_to = channel;
+  c.enable = true;
+  return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+  c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+  c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+  c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+  c->dreq = dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to) {
+  c->chain_to = chain_to;
+}
+
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits) {
+  c->ring_write = write;
+  c->ring_bits = size_bits;
+}
+
+dma_channel_hw_t *dma_channel_hw_addr(uint channel) {
+  return &regs[channel];
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+  channels[channel].config = *config;
+  regs[channel].write_addr = (uintptr_t) write_addr;
+  regs[channel].read_addr = (uintptr_t) read_addr;
+  channels[channel].reload = transfer_count;
+  regs[channel].transfer_count = transfer_count;
+  if (trigger)
+    dma_trigger(channel);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger) {
+  regs[channel].read_addr = (uintptr_t) read_addr;
+  if (trigger)
+    dma_trigger(channel);
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger) {
+  regs[channel].write_addr = (uintptr_t) write_addr;
+  if (trigger)
+    dma_trigger(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+  channels[channel].reload = trans_count;
+  if (trigger)
+    dma_trigger(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+  regs[channel].read_addr = (uintptr_t) read_addr;
+  channels[channel].reload = transfer_count;
+  dma_trigger(channel);
+}
+
+void dma_channel_start(uint channel) {
+  dma_trigger(channel);
+}
+
+void dma_channel_abort(uint channel) {
+  channels[channel].busy = false;
+}
+
+// Consultar um canal ocupado é espera ativa: o tempo virtual anda
+bool dma_channel_is_busy(uint channel) {
+  if (channels[channel].busy)
+    host_advance_ns(HOST_POLL_NS);
+  return channels[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel) {
+  while (dma_channel_is_busy(channel))
+    tight_loop_contents();
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+  if (enabled)
+    inte0 |= 1u << channel;
+  else
+    inte0 &= ~(1u << channel);
+}
+
+bool dma_channel_get_irq0_status(uint channel) {
+  return ints0 & (1u << channel);
+}
+
+void dma_channel_acknowledge_irq0(uint channel) {
+  ints0 &= ~(1u << channel);
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator) {
+  timers[timer].numerator = numerator;
+  timers[timer].denominator = denominator;
+}
+
+uint dma_get_timer_dreq(uint timer_num) {
+  return DREQ_DMA_TIMER0 + timer_num;
+}
@@ -0,0 +1,74 @@
+#include "host_hal.h"
+#include "pico/stdlib.h"
+
+// Pinos digitais: saídas ficam registradas para inspeção; entradas mudam
+// pelo roteiro, disparam o callback de IRQ como interrupção e são vistas
+// pelas máquinas de debounce da PIO
+
+static bool level[NUM_BANK0_GPIOS];
+static bool output[NUM_BANK0_GPIOS];
+static uint32_t irq_events[NUM_BANK0_GPIOS];
+static gpio_irq_callback_t irq_callback;
+static uint64_t input_edges;
+
+void gpio_init(uint gpio) {
+  output[gpio] = false;
+  level[gpio] = false;
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+  output[gpio] = out;
+}
+
+void gpio_put(uint gpio, bool value) {
+  level[gpio] = value;
+}
+
+bool gpio_get(uint gpio) {
+  return level[gpio];
+}
+
+void gpio_pull_up(uint gpio) {
+  if (!output[gpio])
+    level[gpio] = true;
+}
+
+void gpio_pull_down(uint gpio) {
+  if (!output[gpio])
+    level[gpio] = false;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn) {
+  (void) gpio; (void) fn;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled) {
+  if (enabled)
+    irq_events[gpio] |= events;
+  else
+    irq_events[gpio] &= ~events;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback) {
+  gpio_set_irq_enabled(gpio, events, enabled);
+  irq_callback = callback;
+}
+
+void host_gpio_set_input(uint gpio, bool value) {
+  if (level[gpio] == value)
+    return;
+  level[gpio] = value;
+  input_edges++;
+  host_pio_gpio_changed(gpio, value);
+  uint32_t edge = value ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+  if (irq_callback && (irq_events[gpio] & edge))
+    irq_callback(gpio, edge);
+}
+
+bool host_gpio_get_output(uint gpio) {
+  return level[gpio];
+}
+
+uint64_t host_gpio_input_edges(void) {
+  return input_edges;
+}
@@ -0,0 +1,164 @@
+#include "host_hal.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Controlador I2C: cada palavra de DATA_CMD vira um byte para o dispositivo
+// no endereço TAR; o bit STOP encerra a transação. Os dispositivos no
+// barramento são os modelos de SSD1306 (um por endereço).
+//
+// Palavras vindas do DMA ocupam o fio por um byte cada, depois do byte de
+// endereço. MST_ACTIVITY fica ligado até o STOP sair, quando STOP_DET sobe
+// e a interrupção do controlador é sinalizada. Como leituras de registrador
+// pela CPU não passam pelo modelo, STOP_DET só é limpo no próximo START.
+// Acima da taxa máxima do painel o endereço recebe NAK: TX_ABRT sobe com
+// ABRT_7B_ADDR_NOACK e as palavras seguintes são descartadas até o STOP.
+
+void host_ssd1306_begin(uint8_t address);
+void host_ssd1306_byte(uint8_t address, uint8_t byte);
+void host_ssd1306_end(uint8_t address);
+
+static i2c_hw_t i2c0_hw;
+static i2c_hw_t i2c1_hw;
+i2c_inst_t i2c0_inst = {&i2c0_hw, false, 100000};
+i2c_inst_t i2c1_inst = {&i2c1_hw, false, 100000};
+
+static bool in_transaction[2];
+static uint64_t wire_free_ns[2];    // Fim do último byte no fio
+static uint64_t stop_ns[2] = {UINT64_MAX, UINT64_MAX};  // STOP pendente no fio
+static bool aborted[2];             // Endereço recusado; descarta até o STOP
+
+static uint64_t i2c_next(void);
+static void i2c_run(uint64_t now);
+static const host_event_source_t i2c_source = {i2c_next, i2c_run};
+static uint device_max_baudrate = 1000000;
+
+void host_i2c_set_device_max_baudrate(uint baudrate) {
+  device_max_baudrate = baudrate;
+}
+
+static i2c_inst_t *i2c_from_hw(const i2c_hw_t *hw) {
+  return hw == &i2c1_hw ? i2c1 : i2c0;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+  i2c->hw->enable = 1;
+  i2c->hw->status = I2C_IC_STATUS_TFE_BITS | I2C_IC_STATUS_TFNF_BITS;
+  return i2c_set_baudrate(i2c, baudrate);
+}
+
+void i2c_deinit(i2c_inst_t *i2c) {
+  i2c->hw->enable = 0;
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) {
+  i2c->baudrate = baudrate;
+  return baudrate;
+}
+
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) {
+  return DREQ_I2C0_TX + 2 * i2c_hw_index(i2c) + (is_tx ? 0 : 1);
+}
+
+// Nove bits (oito de dados + ACK) por byte na taxa configurada
+static uint64_t i2c_byte_ns(i2c_inst_t *i2c) {
+  return (uint64_t) 9 * 1000000000 / i2c->baudrate;
+}
+
+uint64_t host_i2c_word_ns(uint dreq) {
+  return i2c_byte_ns(dreq >= DREQ_I2C1_TX ? i2c1 : i2c0);
+}
+
+static void i2c_device_byte(i2c_inst_t *i2c, uint8_t address, uint8_t byte, bool stop) {
+  uint index = i2c_hw_index(i2c);
+  if (!in_transaction[index]) {
+    host_ssd1306_begin(address);
+    in_transaction[index] = true;
+  }
+  host_ssd1306_byte(address, byte);
+  if (stop) {
+    host_ssd1306_end(address);
+    in_transaction[index] = false;
+  }
+}
+
+static uint64_t i2c_next(void) {
+  return stop_ns[0] < stop_ns[1] ? stop_ns[0] : stop_ns[1];
+}
+
+static void i2c_run(uint64_t now) {
+  for (uint index = 0; index < 2; ++index) {
+    if (stop_ns[index] > now)
+      continue;
+    stop_ns[index] = UINT64_MAX;
+    aborted[index] = false;
+    i2c_hw_t *hw = index ? &i2c1_hw : &i2c0_hw;
+    hw->status &= ~I2C_IC_STATUS_MST_ACTIVITY_BITS;
+    hw->raw_intr_stat |= I2C_IC_RAW_INTR_STAT_STOP_DET_BITS;
+    if (hw->intr_mask & (I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS |
+                         I2C_IC_INTR_MASK_M_TX_EMPTY_BITS))
+      host_irq_raise(index ? I2C1_IRQ : I2C0_IRQ);
+  }
+}
+
+// Palavra escrita pelo DMA: ocupa o fio por um byte (mais o endereço no
+// START). Retorna false se a palavra não chega ao dispositivo (abort).
+static bool i2c_wire_word(i2c_hw_t *hw, bool stop) {
+  static bool registered = false;
+  if (!registered) {
+    host_register_source(&i2c_source);
+    registered = true;
+  }
+  i2c_inst_t *i2c = i2c_from_hw(hw);
+  uint index = i2c_hw_index(i2c);
+  uint64_t now = host_now_ns();
+  if (aborted[index])
+    return false;
+  uint64_t start = wire_free_ns[index] > now ? wire_free_ns[index] : now;
+  if (!(hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+    hw->status |= I2C_IC_STATUS_MST_ACTIVITY_BITS;
+    hw->raw_intr_stat &= ~(I2C_IC_RAW_INTR_STAT_STOP_DET_BITS | I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS);
+    start += i2c_byte_ns(i2c);
+    if (i2c->baudrate > device_max_baudrate) {
+      aborted[index] = true;
+      hw->raw_intr_stat |= I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+      hw->tx_abrt_source = I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS;
+      wire_free_ns[index] = stop_ns[index] = start;
+      return false;
+    }
+  }
+  wire_free_ns[index] = start + i2c_byte_ns(i2c);
+  if (stop)
+    stop_ns[index] = wire_free_ns[index];
+  return true;
+}
+
+bool host_i2c_is_data_cmd(uintptr_t addr) {
+  return addr == (uintptr_t) &i2c0_hw.data_cmd || addr == (uintptr_t) &i2c1_hw.data_cmd;
+}
+
+void host_i2c_write_word(uintptr_t addr, uint32_t word) {
+  i2c_hw_t *hw = addr == (uintptr_t) &i2c1_hw.data_cmd ? &i2c1_hw : &i2c0_hw;
+  if (i2c_wire_word(hw, word & I2C_IC_DATA_CMD_STOP_BITS))
+    i2c_device_byte(i2c_from_hw(hw), hw->tar, word & 0xFF, word & I2C_IC_DATA_CMD_STOP_BITS);
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+  if (i2c->baudrate > device_max_baudrate) {
+    host_advance_ns(i2c_byte_ns(i2c));      // Só o endereço, sem ACK
+    return PICO_ERROR_GENERIC;
+  }
+  for (size_t i = 0; i < len; ++i)
+    i2c_device_byte(i2c, addr, src[i], !nostop && i + 1 == len);
+  host_advance_ns((len + 1) * i2c_byte_ns(i2c));
+  return (int) len;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+  (void) addr;
+  (void) nostop;
+  for (size_t i = 0; i < len; ++i)
+    dst[i] = 0;
+  host_advance_ns((len + 1) * i2c_byte_ns(i2c));
+  return (int) len;
+}
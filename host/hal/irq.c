@@ -0,0 +1,48 @@
+#include "host_hal.h"
+#include "hardware/irq.h"
+
+// Tabela de tratadores; host_irq_raise() executa os habilitados na hora
+
+#define IRQ_MAX_SHARED 4
+
+static irq_handler_t handlers[IRQ_COUNT][IRQ_MAX_SHARED];
+static bool enabled[IRQ_COUNT];
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+  handlers[num][0] = handler;
+  for (uint i = 1; i < IRQ_MAX_SHARED; ++i)
+    handlers[num][i] = NULL;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+  (void) order_priority;
+  for (uint i = 0; i < IRQ_MAX_SHARED; ++i) {
+    if (!handlers[num][i]) {
+      handlers[num][i] = handler;
+      return;
+    }
+  }
+  host_exit("too many shared IRQ handlers");
+}
+
+void irq_remove_handler(uint num, irq_handler_t handler) {
+  for (uint i = 0; i < IRQ_MAX_SHARED; ++i)
+    if (handlers[num][i] == handler)
+      handlers[num][i] = NULL;
+}
+
+void irq_set_enabled(uint num, bool enable) {
+  enabled[num] = enable;
+}
+
+void irq_set_priority(uint num, uint8_t hardware_priority) {
+  (void) num; (void) hardware_priority;
+}
+
+void host_irq_raise(uint num) {
+  if (!enabled[num])
+    return;
+  for (uint i = 0; i < IRQ_MAX_SHARED; ++i)
+    if (handlers[num][i])
+      handlers[num][i]();
+}
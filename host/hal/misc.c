@@ -0,0 +1,43 @@
+#include "host_hal.h"
+#include <stdarg.h>
+#include "pico/stdlib.h"
+#include "pico/bootrom.h"
+#include "hardware/clocks.h"
+
+// Relógios fixos na configuração padrão do Pico, stdio e bootrom
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+  switch (clk_index) {
+    case clk_ref: return 12000000;
+    case clk_usb: case clk_adc: return 48000000;
+    case clk_rtc: return 46875;
+    default: return 125000000;
+  }
+}
+
+void panic(const char *fmt, ...) {
+  va_list args;
+  fflush(stdout);
+  fputs("*** PANIC ***\n", stderr);
+  va_start(args, fmt);
+  vfprintf(stderr, fmt, args);
+  va_end(args);
+  fputc('\n', stderr);
+  exit(EXIT_FAILURE);
+}
+
+bool stdio_init_all(void) {
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  return true;
+}
+
+// Sem tradução de fim de linha, como no stdio do SDK
+int putchar_raw(int c) {
+  return putchar(c);
+}
+
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask) {
+  (void) usb_activity_gpio_pin_mask;
+  (void) disable_interface_mask;
+  host_exit("reset_usb_boot");
+}
@@ -0,0 +1,99 @@
+#include "host_hal.h"
+#include "pico/multicore.h"
+#include <ucontext.h>
+
+// Núcleo 1 como corrotina (ucontext). Ele roda sempre que o núcleo 0 toca a
+// campainha da FIFO e devolve o controle ao bloquear esperando a próxima
+// palavra, o que mantém a simulação em uma única thread e determinística.
+
+#define CORE1_STACK_SIZE (256 * 1024)
+#define FIFO_DEPTH 8
+
+static ucontext_t core0_context;
+static ucontext_t core1_context;
+static char core1_stack[CORE1_STACK_SIZE];
+static void (*core1_entry)(void);
+static bool core1_running;
+static uint current_core;
+
+// Uma FIFO por núcleo de destino: fifo[1] vai do núcleo 0 ao 1, fifo[0]
+// volta do núcleo 1 ao 0
+static uint32_t fifo[2][FIFO_DEPTH];
+static uint fifo_head[2], fifo_tail[2];
+
+static void core1_trampoline(void) {
+  core1_entry();
+  core1_running = false;
+  current_core = 0;
+}
+
+static void switch_to_core1(void) {
+  if (!core1_running || current_core == 1)
+    return;
+  current_core = 1;
+  swapcontext(&core0_context, &core1_context);
+  current_core = 0;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+  core1_entry = entry;
+  fifo_head[0] = fifo_tail[0] = fifo_head[1] = fifo_tail[1] = 0;
+  getcontext(&core1_context);
+  core1_context.uc_stack.ss_sp = core1_stack;
+  core1_context.uc_stack.ss_size = sizeof(core1_stack);
+  core1_context.uc_link = &core0_context;
+  makecontext(&core1_context, core1_trampoline, 0);
+  core1_running = true;
+  switch_to_core1();
+}
+
+void multicore_reset_core1(void) {
+  core1_running = false;
+}
+
+uint get_core_num(void) {
+  return current_core;
+}
+
+bool multicore_fifo_rvalid(void) {
+  return fifo_head[current_core] != fifo_tail[current_core];
+}
+
+bool multicore_fifo_wready(void) {
+  uint to = current_core ^ 1;
+  return fifo_head[to] - fifo_tail[to] < FIFO_DEPTH;
+}
+
+// Do núcleo 0 a palavra acorda o núcleo 1, que roda até bloquear; do
+// núcleo 1 ela fica na FIFO até o núcleo 0 voltar a rodar
+void multicore_fifo_push_blocking(uint32_t data) {
+  uint to = current_core ^ 1;
+  while (!multicore_fifo_wready()) {
+    if (current_core == 1)
+      swapcontext(&core1_context, &core0_context);
+    else if (core1_running)
+      switch_to_core1();
+    else
+      host_exit("multicore_fifo_push_blocking: FIFO cheia e núcleo 1 parado");
+  }
+  fifo[to][fifo_head[to]++ % FIFO_DEPTH] = data;
+  if (current_core == 0)
+    switch_to_core1();
+}
+
+uint32_t multicore_fifo_pop_blocking(void) {
+  uint from = current_core;
+  while (fifo_head[from] == fifo_tail[from]) {
+    // FIFO vazia: o núcleo 1 dorme e o núcleo 0 continua; o núcleo 0 cede
+    // ao núcleo 1 e deixa o tempo correr até a resposta chegar
+    if (from == 1) {
+      swapcontext(&core1_context, &core0_context);
+    } else if (core1_running) {
+      switch_to_core1();
+      tight_loop_contents();
+    } else {
+      host_exit("multicore_fifo_pop_blocking: núcleo 1 parado");
+    }
+  }
+  return fifo[from][fifo_tail[from]++ % FIFO_DEPTH];
+}
@@ -0,0 +1,261 @@
+#include "host_hal.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "buttons.pio.h"
+#include <string.h>
+
+// PIO sem execução de instruções. Uma máquina iniciada no programa de
+// buttons.pio aplica o mesmo debounce ao nível da GPIO no tempo virtual e
+// entrega as transições na FIFO RX; nas demais a FIFO TX alimenta o modelo
+// da cadeia WS2812. Um intervalo sem dados maior que o reset trava o quadro
+// recebido.
+
+#define WS2812_WORD_NS 30000        // 24 bits a 800 kHz
+#define WS2812_RESET_NS 50000       // Nível baixo mínimo para travar
+#define PIO_RX_FIFO_LEN 4
+
+pio_hw_t pio0_hw_inst;
+pio_hw_t pio1_hw_inst;
+
+static uint program_offset[2];
+static uint8_t claimed_sm[2];
+static int debounce_offset[2] = {-1, -1};   // Onde buttons.pio foi carregado
+static uint32_t irq0_sources[2];
+
+typedef struct {
+  bool debounce;                    // Roda o programa de buttons.pio
+  uint pin;
+  uint64_t sample_ns;
+  uint32_t samples;                 // Amostras iguais para aceitar (0 até o 'pull' inicial)
+  bool level;                       // Nível aceito; começa solto (alto)
+  uint64_t since_ns;                // Desde quando o pino difere do aceito
+  uint32_t rx[PIO_RX_FIFO_LEN];
+  uint rx_head, rx_count;
+} sm_model_t;
+
+static sm_model_t machines[2][NUM_PIO_STATE_MACHINES];
+
+static host_ws2812_t chain;
+static uint32_t pending[HOST_WS2812_MAX_LEDS];
+static uint pending_count;
+static uint64_t line_free_ns;       // Fim da última palavra no fio
+
+static void ws2812_latch_if_idle(uint64_t now) {
+  if (pending_count && now >= line_free_ns + WS2812_RESET_NS) {
+    memcpy(chain.leds, pending, pending_count * sizeof(pending[0]));
+    chain.count = pending_count;
+    chain.frames++;
+    pending_count = 0;
+  }
+}
+
+const host_ws2812_t *host_ws2812(void) {
+  ws2812_latch_if_idle(host_now_ns());
+  return &chain;
+}
+
+bool host_pio_is_txf(uintptr_t addr) {
+  return (addr >= (uintptr_t) pio0_hw_inst.txf && addr < (uintptr_t) (pio0_hw_inst.txf + NUM_PIO_STATE_MACHINES)) ||
+         (addr >= (uintptr_t) pio1_hw_inst.txf && addr < (uintptr_t) (pio1_hw_inst.txf + NUM_PIO_STATE_MACHINES));
+}
+
+static void ws2812_write(uint32_t word) {
+  uint64_t now = host_now_ns();
+  ws2812_latch_if_idle(now);
+  if (pending_count < HOST_WS2812_MAX_LEDS)
+    pending[pending_count++] = word;
+  chain.words++;
+  line_free_ns = (now > line_free_ns ? now : line_free_ns) + WS2812_WORD_NS;
+}
+
+static void txf_write(PIO pio, uint sm, uint32_t word) {
+  sm_model_t *machine = &machines[pio_get_index(pio)][sm];
+  if (!machine->debounce)
+    ws2812_write(word);
+  else if (!machine->samples)
+    machine->samples = word + 1;    // 'pull block' do início do programa
+}
+
+void host_pio_write_txf(uintptr_t addr, uint32_t word) {
+  PIO pio = addr >= (uintptr_t) pio1_hw_inst.txf && addr < (uintptr_t) (pio1_hw_inst.txf + NUM_PIO_STATE_MACHINES) ? pio1 : pio0;
+  txf_write(pio, (addr - (uintptr_t) pio->txf) / sizeof(pio->txf[0]), word);
+}
+
+// ---------------------------------------------------------------- debounce
+static bool debounce_active(uint index, uint sm) {
+  const sm_model_t *machine = &machines[index][sm];
+  PIO pio = index ? pio1 : pio0;
+  return machine->debounce && machine->samples && (pio->ctrl & (1u << sm));
+}
+
+static uint64_t debounce_next(void) {
+  uint64_t next = UINT64_MAX;
+  for (uint index = 0; index < 2; ++index) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+      const sm_model_t *machine = &machines[index][sm];
+      if (!debounce_active(index, sm) || machine->since_ns == UINT64_MAX)
+        continue;
+      uint64_t t = machine->since_ns + machine->samples * machine->sample_ns;
+      if (t < next)
+        next = t;
+    }
+  }
+  return next;
+}
+
+// Nível mantido pelas amostras necessárias: transição aceita, uma palavra
+// na FIFO RX (descartada se cheia, como 'push noblock') e a interrupção
+static void debounce_run(uint64_t now) {
+  for (uint index = 0; index < 2; ++index) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+      sm_model_t *machine = &machines[index][sm];
+      if (!debounce_active(index, sm) || machine->since_ns == UINT64_MAX ||
+          machine->since_ns + machine->samples * machine->sample_ns > now)
+        continue;
+      machine->level = !machine->level;
+      machine->since_ns = UINT64_MAX;
+      if (machine->rx_count < PIO_RX_FIFO_LEN) {
+        machine->rx[(machine->rx_head + machine->rx_count++) % PIO_RX_FIFO_LEN] = machine->level ? 0xffffffffu : 0;
+        if (irq0_sources[index] & (1u << (pis_sm0_rx_fifo_not_empty + sm)))
+          host_irq_raise(index ? PIO1_IRQ_0 : PIO0_IRQ_0);
+      }
+    }
+  }
+}
+
+static const host_event_source_t debounce_source = {debounce_next, debounce_run};
+
+// Mudança de nível no pino: a contagem recomeça a cada repique
+void host_pio_gpio_changed(uint gpio, bool level) {
+  for (uint index = 0; index < 2; ++index) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+      sm_model_t *machine = &machines[index][sm];
+      if (machine->debounce && machine->pin == gpio)
+        machine->since_ns = level != machine->level ? host_now_ns() : UINT64_MAX;
+    }
+  }
+}
+
+uint pio_get_index(PIO pio) {
+  return pio == pio1;
+}
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx) {
+  return (pio_get_index(pio) ? DREQ_PIO1_TX0 : DREQ_PIO0_TX0) + sm + (is_tx ? 0 : NUM_PIO_STATE_MACHINES);
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program) {
+  uint index = pio_get_index(pio);
+  uint offset = program_offset[index];
+  program_offset[index] += program->length;
+  if (program->length == button_debounce_program.length &&
+      !memcmp(program->instructions, button_debounce_program.instructions, program->length * sizeof(uint16_t)))
+    debounce_offset[index] = offset;
+  return offset;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required) {
+  uint index = pio_get_index(pio);
+  for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+    if (!(claimed_sm[index] & (1u << sm))) {
+      claimed_sm[index] |= 1u << sm;
+      return sm;
+    }
+  }
+  if (required)
+    host_exit("no free PIO state machine");
+  return -1;
+}
+
+void pio_gpio_init(PIO pio, uint pin) {
+  (void) pio; (void) pin;
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out) {
+  (void) pio; (void) sm; (void) pin_base; (void) pin_count; (void) is_out;
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config) {
+  uint index = pio_get_index(pio);
+  sm_model_t *machine = &machines[index][sm];
+  memset(machine, 0, sizeof(*machine));
+  machine->debounce = (int) initial_pc == debounce_offset[index];
+  machine->pin = (config->execctrl >> 24) & 0x1f;
+  machine->sample_ns = (uint64_t) config->clkdiv * BUTTON_DEBOUNCE_CYCLES_PER_SAMPLE * 1000000000 /
+                       (256ull * clock_get_hz(clk_sys));
+  machine->level = true;
+  machine->since_ns = UINT64_MAX;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) {
+  static bool registered = false;
+  sm_model_t *machine = &machines[pio_get_index(pio)][sm];
+  if (enabled)
+    pio->ctrl |= 1u << sm;
+  else
+    pio->ctrl &= ~(1u << sm);
+  if (enabled && machine->debounce) {
+    if (!registered) {
+      host_register_source(&debounce_source);
+      registered = true;
+    }
+    host_pio_gpio_changed(machine->pin, gpio_get(machine->pin));
+  }
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data) {
+  txf_write(pio, sm, data);
+}
+
+// Com a FIFO cheia o envio espera o fio liberar
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {
+  uint64_t now = host_now_ns();
+  if (line_free_ns > now + 4 * WS2812_WORD_NS)
+    host_advance_to_ns(line_free_ns - 4 * WS2812_WORD_NS);
+  pio_sm_put(pio, sm, data);
+}
+
+uint32_t pio_sm_get(PIO pio, uint sm) {
+  sm_model_t *machine = &machines[pio_get_index(pio)][sm];
+  if (!machine->rx_count)
+    return 0;
+  uint32_t word = machine->rx[machine->rx_head];
+  machine->rx_head = (machine->rx_head + 1) % PIO_RX_FIFO_LEN;
+  machine->rx_count--;
+  return word;
+}
+
+// Só as máquinas de debounce produzem dados: espera a próxima transição
+uint32_t pio_sm_get_blocking(PIO pio, uint sm) {
+  while (pio_sm_is_rx_fifo_empty(pio, sm))
+    host_wait_for_event();
+  return pio_sm_get(pio, sm);
+}
+
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm) {
+  return !machines[pio_get_index(pio)][sm].rx_count;
+}
+
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm) {
+  const sm_model_t *machine = &machines[pio_get_index(pio)][sm];
+  if (machine->debounce)
+    return machine->samples != 0;
+  return host_now_ns() >= line_free_ns;
+}
+
+// Palavras do WS2812 que ainda não começaram a sair (a que está no fio é
+// a do OSR); as máquinas de debounce não usam a FIFO de entrada
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm) {
+  uint64_t now = host_now_ns();
+  if (machines[pio_get_index(pio)][sm].debounce || now >= line_free_ns)
+    return 0;
+  return (line_free_ns - now - 1) / WS2812_WORD_NS;
+}
+
+void pio_set_irq0_source_enabled(PIO pio, uint source, bool enabled) {
+  if (enabled)
+    irq0_sources[pio_get_index(pio)] |= 1u << source;
+  else
+    irq0_sources[pio_get_index(pio)] &= ~(1u << source);
+}
@@ -0,0 +1,64 @@
+#include "host_hal.h"
+#include "hardware/pwm.h"
+
+// PWM só guarda os registradores; o nível dos buzzers pode ser lido em pwm_hw
+
+static pwm_hw_t pwm_regs;
+pwm_hw_t *pwm_hw = &pwm_regs;
+
+pwm_config pwm_get_default_config(void) {
+  pwm_config c = {0, 1u << 4, 0xFFFF};
+  return c;
+}
+
+void pwm_config_set_clkdiv(pwm_config *c, float div) {
+  c->div = (uint32_t) (div * 16.0f);
+}
+
+void pwm_config_set_clkdiv_int_frac(pwm_config *c, uint8_t integer, uint8_t fract) {
+  c->div = ((uint32_t) integer << 4) | fract;
+}
+
+void pwm_config_set_wrap(pwm_config *c, uint16_t wrap) {
+  c->top = wrap;
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start) {
+  pwm_regs.slice[slice_num].csr = c->csr;
+  pwm_regs.slice[slice_num].div = c->div;
+  pwm_regs.slice[slice_num].top = c->top;
+  pwm_regs.slice[slice_num].cc = 0;
+  pwm_set_enabled(slice_num, start);
+}
+
+void pwm_set_clkdiv(uint slice_num, float divider) {
+  pwm_regs.slice[slice_num].div = (uint32_t) (divider * 16.0f);
+}
+
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract) {
+  pwm_regs.slice[slice_num].div = ((uint32_t) integer << 4) | fract;
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+  pwm_regs.slice[slice_num].top = wrap;
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level) {
+  uint32_t cc = pwm_regs.slice[slice_num].cc;
+  if (chan == PWM_CHAN_B)
+    cc = (cc & 0x0000FFFFu) | ((uint32_t) level << 16);
+  else
+    cc = (cc & 0xFFFF0000u) | level;
+  pwm_regs.slice[slice_num].cc = cc;
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level) {
+  pwm_set_chan_level(pwm_gpio_to_slice_num(gpio), pwm_gpio_to_channel(gpio), level);
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled) {
+  if (enabled)
+    pwm_regs.slice[slice_num].csr |= 1u;
+  else
+    pwm_regs.slice[slice_num].csr &= ~1u;
+}
@@ -0,0 +1,177 @@
+#include "host_hal.h"
+#include <string.h>
+
+// Modelo do SSD1306 no lado do barramento: interpreta bytes de controle
+// (Co, D/C), comandos com seus argumentos e grava os dados na GDDRAM
+// seguindo o modo de endereçamento e a janela de colunas/páginas. Há um
+// painel em cada endereço do SSD1306 (0x3C e 0x3D); bytes para outros
+// endereços são descartados.
+
+typedef enum {
+  STATE_CONTROL,                    // Próximo byte é de controle
+  STATE_SINGLE,                     // Co = 1: um byte e volta ao controle
+  STATE_STREAM                      // Co = 0: o resto da transação
+} parse_state_t;
+
+typedef struct {
+  host_ssd1306_t display;
+  parse_state_t state;
+  bool data_mode;
+  uint8_t command[8];
+  uint command_len;
+  uint command_need;
+  uint8_t mem_mode;
+  uint8_t col_start, col_end;
+  uint8_t page_start, page_end;
+  uint8_t col, page;
+} panel_t;
+
+static panel_t panels[HOST_SSD1306_PANELS];
+
+static panel_t *panel_at(uint8_t address) {
+  if (address < HOST_SSD1306_ADDRESS || address >= HOST_SSD1306_ADDRESS + HOST_SSD1306_PANELS)
+    return NULL;
+  panel_t *panel = &panels[address - HOST_SSD1306_ADDRESS];
+  if (!panel->col_end) {
+    // Estado após o reset: endereçamento por página, janela inteira
+    panel->mem_mode = 2;
+    panel->col_end = HOST_SSD1306_WIDTH - 1;
+    panel->page_end = HOST_SSD1306_PAGES - 1;
+  }
+  return panel;
+}
+
+const host_ssd1306_t *host_ssd1306(void) {
+  return host_ssd1306_at(HOST_SSD1306_ADDRESS);
+}
+
+const host_ssd1306_t *host_ssd1306_at(uint8_t address) {
+  panel_t *panel = panel_at(address);
+  return panel ? &panel->display : NULL;
+}
+
+// Número de argumentos que seguem cada comando
+static uint command_args(uint8_t op) {
+  switch (op) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD6: case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    default:
+      return 0;
+  }
+}
+
+static void execute_command(panel_t *p) {
+  uint8_t op = p->command[0];
+  if (op <= 0x0F) {
+    p->col = (p->col & 0xF0) | op;
+  } else if (op <= 0x1F) {
+    p->col = (p->col & 0x0F) | ((op & 0x0F) << 4);
+  } else if (op == 0x20) {
+    p->mem_mode = p->command[1] & 3;
+  } else if (op == 0x21) {
+    p->col_start = p->col = p->command[1] & 0x7F;
+    p->col_end = p->command[2] & 0x7F;
+  } else if (op == 0x22) {
+    p->page_start = p->page = p->command[1] & 7;
+    p->page_end = p->command[2] & 7;
+  } else if (op >= 0xB0 && op <= 0xB7) {
+    p->page = op & 7;
+  } else if (op == 0xAE || op == 0xAF) {
+    p->display.display_on = op & 1;
+  } else if (op >= 0x40 && op <= 0x7F) {
+    p->display.start_line = op & 0x3F;
+  } else if (op == 0x2E) {
+    p->display.scrolling = false;
+  } else if (op == 0x2F) {
+    p->display.scrolling = true;
+  }
+}
+
+static void command_byte(panel_t *p, uint8_t byte) {
+  if (p->command_len == 0)
+    p->command_need = 1 + command_args(byte);
+  p->command[p->command_len++] = byte;
+  if (p->command_len == p->command_need) {
+    execute_command(p);
+    p->command_len = 0;
+  }
+}
+
+static void data_byte(panel_t *p, uint8_t byte) {
+  p->display.gddram[p->page][p->col] = byte;
+  p->display.data_bytes++;
+  if (p->display.scrolling)
+    p->display.scroll_data_bytes++;
+  if (p->mem_mode == 0) {
+    if (p->col++ >= p->col_end) {
+      p->col = p->col_start;
+      p->page = p->page >= p->page_end ? p->page_start : p->page + 1;
+    }
+  } else if (p->mem_mode == 1) {
+    if (p->page++ >= p->page_end) {
+      p->page = p->page_start;
+      p->col = p->col >= p->col_end ? p->col_start : p->col + 1;
+    }
+  } else {
+    p->col = (p->col + 1) & 0x7F;
+  }
+}
+
+void host_ssd1306_begin(uint8_t address) {
+  panel_t *p = panel_at(address);
+  if (p)
+    p->state = STATE_CONTROL;
+}
+
+void host_ssd1306_byte(uint8_t address, uint8_t byte) {
+  panel_t *p = panel_at(address);
+  if (!p)
+    return;
+  p->display.bytes++;
+  switch (p->state) {
+    case STATE_CONTROL:
+      p->data_mode = byte & 0x40;
+      p->state = (byte & 0x80) ? STATE_SINGLE : STATE_STREAM;
+      break;
+    case STATE_SINGLE:
+      if (p->data_mode) data_byte(p, byte); else command_byte(p, byte);
+      p->state = STATE_CONTROL;
+      break;
+    case STATE_STREAM:
+      if (p->data_mode) data_byte(p, byte); else command_byte(p, byte);
+      break;
+  }
+}
+
+void host_ssd1306_end(uint8_t address) {
+  panel_t *p = panel_at(address);
+  if (p)
+    p->display.transactions++;
+}
+
+// Desenha a tela em texto (um caractere por pixel), a partir da linha inicial
+void host_ssd1306_dump(FILE *out) {
+  host_ssd1306_dump_at(HOST_SSD1306_ADDRESS, out);
+}
+
+void host_ssd1306_dump_at(uint8_t address, FILE *out) {
+  const panel_t *p = panel_at(address);
+  if (!p)
+    return;
+  for (uint row = 0; row < HOST_SSD1306_PAGES * 8; ++row) {
+    char line[HOST_SSD1306_WIDTH + 2];
+    uint y = (row + p->display.start_line) % (HOST_SSD1306_PAGES * 8);
+    for (uint x = 0; x < HOST_SSD1306_WIDTH; ++x)
+      line[x] = (p->display.gddram[y / 8][x] >> (y % 8)) & 1 ? '#' : '.';
+    line[HOST_SSD1306_WIDTH] = '\n';
+    line[HOST_SSD1306_WIDTH + 1] = '\0';
+    fputs(line, out);
+  }
+}
@@ -0,0 +1,53 @@
+// Equivalente de host do cabeçalho gerado por pioasm a partir de buttons.pio.
+// As instruções não são executadas: o modelo da PIO reconhece o programa e
+// aplica o mesmo debounce ao nível da GPIO no tempo virtual.
+
+#pragma once
+
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+
+#define button_debounce_wrap_target 1
+#define button_debounce_wrap 11
+
+static const uint16_t button_debounce_program_instructions[] = {
+    0x80a0, //  0: pull   block
+            //     .wrap_target
+    0xa027, //  1: mov    x, osr
+    0x00c1, //  2: jmp    pin, 1
+    0x0042, //  3: jmp    x--, 2
+    0xa0c3, //  4: mov    isr, null
+    0x8000, //  5: push   noblock
+    0xa027, //  6: mov    x, osr
+    0x00c9, //  7: jmp    pin, 9
+    0x0006, //  8: jmp    6
+    0x0047, //  9: jmp    x--, 7
+    0xa0cb, // 10: mov    isr, ~null
+    0x8000, // 11: push   noblock
+            //     .wrap
+};
+
+static const struct pio_program button_debounce_program = {
+    .instructions = button_debounce_program_instructions,
+    .length = 12,
+    .origin = -1,
+};
+
+static inline pio_sm_config button_debounce_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + button_debounce_wrap_target, offset + button_debounce_wrap);
+    return c;
+}
+
+#define BUTTON_DEBOUNCE_CYCLES_PER_SAMPLE 2
+
+static inline void button_debounce_program_init(PIO pio, uint sm, uint offset, uint pin, uint sample_hz, uint32_t samples)
+{
+    pio_sm_config c = button_debounce_program_get_default_config(offset);
+    sm_config_set_jmp_pin(&c, pin);
+    float div = clock_get_hz(clk_sys) / (float) (sample_hz * BUTTON_DEBOUNCE_CYCLES_PER_SAMPLE);
+    sm_config_set_clkdiv(&c, div);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_put(pio, sm, samples - 1);
+    pio_sm_set_enabled(pio, sm, true);
+}
@@ -0,0 +1,94 @@
+#ifndef _HARDWARE_DMA_H
+#define _HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_DMA_CHANNELS 12
+#define NUM_DMA_TIMERS 4
+
+// Números de DREQ do RP2040
+#define DREQ_PIO0_TX0 0
+#define DREQ_PIO0_RX0 4
+#define DREQ_PIO1_TX0 8
+#define DREQ_PIO1_RX0 12
+#define DREQ_I2C0_TX 32
+#define DREQ_I2C0_RX 33
+#define DREQ_I2C1_TX 34
+#define DREQ_I2C1_RX 35
+#define DREQ_ADC 36
+#define DREQ_DMA_TIMER0 0x3b
+#define DREQ_DMA_TIMER1 0x3c
+#define DREQ_DMA_TIMER2 0x3d
+#define DREQ_DMA_TIMER3 0x3e
+#define DREQ_FORCE 0x3f
+
+enum dma_channel_transfer_size {
+  DMA_SIZE_8 = 0,
+  DMA_SIZE_16 = 1,
+  DMA_SIZE_32 = 2
+};
+
+// Configuração decodificada (no RP2040 é a palavra CTRL)
+typedef struct {
+  uint8_t size;
+  bool read_increment;
+  bool write_increment;
+  uint8_t dreq;
+  uint8_t chain_to;
+  bool ring_write;
+  uint8_t ring_bits;
+  bool enable;
+} dma_channel_config;
+
+// Registradores por canal; no host os endereços ocupam uma palavra nativa
+typedef struct {
+  volatile uintptr_t read_addr;
+  volatile uintptr_t write_addr;
+  volatile uintptr_t transfer_count;
+  volatile uintptr_t ctrl_trig;
+  volatile uintptr_t al1_ctrl;
+  volatile uintptr_t al1_read_addr;
+  volatile uintptr_t al1_write_addr;
+  volatile uintptr_t al1_transfer_count_trig;
+} dma_channel_hw_t;
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+int dma_claim_unused_timer(bool required);
+
+dma_channel_config dma_channel_get_default_config(uint channel);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to);
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits);
+
+dma_channel_hw_t *dma_channel_hw_addr(uint channel);
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_wait_for_finish_blocking(uint channel);
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+bool dma_channel_get_irq0_status(uint channel);
+void dma_channel_acknowledge_irq0(uint channel);
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator);
+uint dma_get_timer_dreq(uint timer_num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
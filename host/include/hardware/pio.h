@@ -0,0 +1,118 @@
+#ifndef _HARDWARE_PIO_H
+#define _HARDWARE_PIO_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_PIO_STATE_MACHINES 4
+
+typedef struct {
+  volatile uint32_t ctrl, fstat, fdebug, flevel;
+  volatile uint32_t txf[NUM_PIO_STATE_MACHINES];
+  volatile uint32_t rxf[NUM_PIO_STATE_MACHINES];
+  volatile uint32_t irq, irq_force;
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t pio0_hw_inst;
+extern pio_hw_t pio1_hw_inst;
+#define pio0 (&pio0_hw_inst)
+#define pio1 (&pio1_hw_inst)
+
+typedef struct {
+  uint32_t clkdiv;
+  uint32_t execctrl;
+  uint32_t shiftctrl;
+  uint32_t pinctrl;
+} pio_sm_config;
+
+typedef struct pio_program {
+  const uint16_t *instructions;
+  uint8_t length;
+  int8_t origin;
+} pio_program_t;
+
+enum pio_interrupt_source {
+  pis_sm0_rx_fifo_not_empty = 0,
+  pis_sm1_rx_fifo_not_empty = 1,
+  pis_sm2_rx_fifo_not_empty = 2,
+  pis_sm3_rx_fifo_not_empty = 3,
+  pis_sm0_tx_fifo_not_full = 4,
+  pis_sm1_tx_fifo_not_full = 5,
+  pis_sm2_tx_fifo_not_full = 6,
+  pis_sm3_tx_fifo_not_full = 7,
+};
+
+enum pio_fifo_join {
+  PIO_FIFO_JOIN_NONE = 0,
+  PIO_FIFO_JOIN_TX = 1,
+  PIO_FIFO_JOIN_RX = 2,
+};
+
+static inline pio_sm_config pio_get_default_sm_config(void) {
+  pio_sm_config c = {0, 0, 0, 0};
+  return c;
+}
+
+static inline void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap) {
+  c->execctrl = (c->execctrl & ~0x1ff80u) | (wrap_target << 7) | (wrap << 12);
+}
+
+static inline void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count) {
+  (void) c; (void) set_base; (void) set_count;
+}
+
+static inline void sm_config_set_in_pins(pio_sm_config *c, uint in_base) {
+  (void) c; (void) in_base;
+}
+
+static inline void sm_config_set_jmp_pin(pio_sm_config *c, uint pin) {
+  c->execctrl = (c->execctrl & ~(0x1fu << 24)) | (pin << 24);
+}
+
+static inline void sm_config_set_clkdiv(pio_sm_config *c, float div) {
+  c->clkdiv = (uint32_t) (div * 256.0f);
+}
+
+static inline void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join) {
+  (void) c; (void) join;
+}
+
+static inline void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold) {
+  (void) c; (void) shift_right; (void) autopull; (void) pull_threshold;
+}
+
+static inline void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold) {
+  (void) c; (void) shift_right; (void) autopush; (void) push_threshold;
+}
+
+static inline void sm_config_set_out_special(pio_sm_config *c, bool sticky, bool has_enable_pin, uint enable_pin_index) {
+  (void) c; (void) sticky; (void) has_enable_pin; (void) enable_pin_index;
+}
+
+uint pio_get_index(PIO pio);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+uint pio_add_program(PIO pio, const pio_program_t *program);
+int pio_claim_unused_sm(PIO pio, bool required);
+void pio_gpio_init(PIO pio, uint pin);
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out);
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_put(PIO pio, uint sm, uint32_t data);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+uint32_t pio_sm_get(PIO pio, uint sm);
+uint32_t pio_sm_get_blocking(PIO pio, uint sm);
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm);
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm);
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm);
+void pio_set_irq0_source_enabled(PIO pio, uint source, bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
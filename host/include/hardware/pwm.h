@@ -0,0 +1,58 @@
+#ifndef _HARDWARE_PWM_H
+#define _HARDWARE_PWM_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_PWM_SLICES 8
+
+enum pwm_chan {
+  PWM_CHAN_A = 0,
+  PWM_CHAN_B = 1
+};
+
+typedef struct {
+  uint32_t csr;
+  uint32_t div;
+  uint32_t top;
+} pwm_config;
+
+typedef struct {
+  volatile uint32_t csr, div, ctr, cc, top;
+} pwm_slice_hw_t;
+
+typedef struct {
+  pwm_slice_hw_t slice[NUM_PWM_SLICES];
+  volatile uint32_t en, intr, inte, intf, ints;
+} pwm_hw_t;
+
+extern pwm_hw_t *pwm_hw;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio) {
+  return (gpio >> 1u) & 7u;
+}
+
+static inline uint pwm_gpio_to_channel(uint gpio) {
+  return gpio & 1u;
+}
+
+pwm_config pwm_get_default_config(void);
+void pwm_config_set_clkdiv(pwm_config *c, float div);
+void pwm_config_set_clkdiv_int_frac(pwm_config *c, uint8_t integer, uint8_t fract);
+void pwm_config_set_wrap(pwm_config *c, uint16_t wrap);
+void pwm_init(uint slice_num, pwm_config *c, bool start);
+void pwm_set_clkdiv(uint slice_num, float divider);
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract);
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level);
+void pwm_set_gpio_level(uint gpio, uint16_t level);
+void pwm_set_enabled(uint slice_num, bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef _HARDWARE_SYNC_H
+#define _HARDWARE_SYNC_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Interrupções simuladas só disparam dentro do avanço do relógio virtual,
+// então seções críticas não precisam mascarar nada
+static inline uint32_t save_and_disable_interrupts(void) {
+  return 0;
+}
+
+static inline void restore_interrupts(uint32_t status) {
+  (void) status;
+}
+
+static inline void __dmb(void) {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __sev(void) {
+}
+
+// Dormir até o próximo evento avança o relógio virtual até ele
+void __wfe(void);
+void __wfi(void);
+
+// Travas de hardware: no host os dois núcleos se alternam numa única thread,
+// então basta a interface
+typedef volatile uint32_t spin_lock_t;
+
+static inline int spin_lock_claim_unused(bool required) {
+  (void) required;
+  return 0;
+}
+
+static inline spin_lock_t *spin_lock_instance(uint lock_num) {
+  static spin_lock_t locks[32];
+  return &locks[lock_num];
+}
+
+static inline uint32_t spin_lock_blocking(spin_lock_t *lock) {
+  *lock = 1;
+  return 0;
+}
+
+static inline void spin_unlock(spin_lock_t *lock, uint32_t saved_irq) {
+  (void) saved_irq;
+  *lock = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
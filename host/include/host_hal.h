@@ -0,0 +1,112 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// API exclusiva do build de host: relógio virtual, eventos roteirizados e
+// modelos dos periféricos (SSD1306, WS2812, ADC). O firmware não a usa.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef unsigned int uint;
+
+// ---------------------------------------------------------------- relógio
+#define HOST_POLL_NS 1000           // Tempo consumido por iteração de espera ativa
+
+uint64_t host_now_ns(void);
+void host_advance_ns(uint64_t ns);
+void host_advance_to_ns(uint64_t deadline);
+void host_wait_for_event(void);
+void host_set_time_limit_us(uint64_t limit_us);
+
+// Fonte genérica de eventos: next() devolve o próximo instante (UINT64_MAX
+// se nenhum) e run() executa tudo que vence até o instante atual
+typedef struct {
+  uint64_t (*next)(void);
+  void (*run)(uint64_t now);
+} host_event_source_t;
+
+void host_register_source(const host_event_source_t *source);
+
+// Chamado ao atingir o limite de tempo ou reset_usb_boot()
+typedef void (*host_exit_fn_t)(const char *reason);
+void host_set_exit_handler(host_exit_fn_t handler);
+void host_exit(const char *reason);
+
+// ---------------------------------------------------------------- barramento
+// Acessos do DMA passam por aqui para que registradores com efeito colateral
+// (FIFO do ADC, DATA_CMD do I2C, TXF da PIO, gatilhos do DMA) sejam modelados
+uint32_t host_bus_read(uintptr_t addr, uint size);
+void host_bus_write(uintptr_t addr, uint32_t value, uint size);
+
+bool host_i2c_is_data_cmd(uintptr_t addr);
+void host_i2c_write_word(uintptr_t addr, uint32_t word);
+uint64_t host_i2c_word_ns(uint dreq);
+// Maior taxa que o painel reconhece; acima dela as escritas bloqueantes
+// recebem NAK (padrão: 1 MHz)
+void host_i2c_set_device_max_baudrate(uint baudrate);
+
+bool host_pio_is_txf(uintptr_t addr);
+void host_pio_write_txf(uintptr_t addr, uint32_t word);
+void host_pio_gpio_changed(uint gpio, bool level);
+
+bool host_adc_is_fifo(uintptr_t addr);
+uint16_t host_adc_fifo_pop(void);
+uint64_t host_adc_sample_ns(void);
+
+bool host_dma_is_register(uintptr_t addr);
+void host_dma_write_register(uintptr_t addr, uint32_t value);
+
+void host_irq_raise(uint num);
+
+// ---------------------------------------------------------------- entradas
+typedef uint16_t (*host_adc_source_t)(uint input, uint64_t now_us);
+void host_adc_set_source(host_adc_source_t source);
+
+void host_gpio_set_input(uint gpio, bool level);
+bool host_gpio_get_output(uint gpio);
+uint64_t host_gpio_input_edges(void);     // Bordas nas entradas, repiques incluídos
+
+// ---------------------------------------------------------------- modelos
+#define HOST_SSD1306_WIDTH 128
+#define HOST_SSD1306_PAGES 8
+#define HOST_SSD1306_ADDRESS 0x3C         // Primeiro painel; o segundo fica em 0x3D
+#define HOST_SSD1306_PANELS 2
+
+typedef struct {
+  uint8_t gddram[HOST_SSD1306_PAGES][HOST_SSD1306_WIDTH];
+  uint64_t bytes;                   // Bytes recebidos (incluindo controle)
+  uint64_t transactions;            // Transações encerradas por STOP
+  uint64_t data_bytes;              // Bytes gravados na GDDRAM
+  uint64_t scroll_data_bytes;       // Dos quais com a rolagem ativa (proibido pelo datasheet)
+  bool display_on;
+  bool scrolling;                   // Rolagem por hardware ativa
+  uint8_t start_line;               // Linha da GDDRAM exibida no topo
+} host_ssd1306_t;
+
+const host_ssd1306_t *host_ssd1306(void);
+const host_ssd1306_t *host_ssd1306_at(uint8_t address);  // NULL fora de 0x3C/0x3D
+void host_ssd1306_dump(FILE *out);
+void host_ssd1306_dump_at(uint8_t address, FILE *out);
+
+#define HOST_WS2812_MAX_LEDS 1024
+
+typedef struct {
+  uint32_t leds[HOST_WS2812_MAX_LEDS];  // Último quadro travado (GRB << 8)
+  uint count;                           // LEDs no último quadro
+  uint64_t frames;                      // Quadros travados
+  uint64_t words;                       // Palavras recebidas pela FIFO
+} host_ws2812_t;
+
+const host_ws2812_t *host_ws2812(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
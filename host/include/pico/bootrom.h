@@ -0,0 +1,17 @@
+#ifndef _PICO_BOOTROM_H
+#define _PICO_BOOTROM_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// No host, reiniciar em BOOTSEL encerra a simulação
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
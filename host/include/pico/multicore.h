@@ -0,0 +1,24 @@
+#ifndef _PICO_MULTICORE_H
+#define _PICO_MULTICORE_H
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// O núcleo 1 é uma corrotina: roda até bloquear esperando a FIFO e então
+// devolve o controle ao núcleo 0, de forma determinística
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+uint get_core_num(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+// Equivalente de host do cabeçalho gerado por pioasm a partir de ws2812.pio.
+// As instruções não são executadas: o modelo da PIO consome a FIFO TX com o
+// tempo de linha fixo do protocolo WS2812.
+
+#pragma once
+
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+
+#define pio_matrix_wrap_target 0
+#define pio_matrix_wrap 6
+
+static const uint16_t pio_matrix_program_instructions[] = {
+            //     .wrap_target
+    0x6021, //  0: out    x, 1
+    0x0024, //  1: jmp    !x, 4
+    0xe401, //  2: set    pins, 1                [4]
+    0x0006, //  3: jmp    6
+    0xe201, //  4: set    pins, 1                [2]
+    0xe200, //  5: set    pins, 0                [2]
+    0xe100, //  6: set    pins, 0                [1]
+            //     .wrap
+};
+
+static const struct pio_program pio_matrix_program = {
+    .instructions = pio_matrix_program_instructions,
+    .length = 7,
+    .origin = -1,
+};
+
+static inline pio_sm_config pio_matrix_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + pio_matrix_wrap_target, offset + pio_matrix_wrap);
+    return c;
+}
+
+static inline void pio_matrix_program_init(PIO pio, uint sm, uint offset, uint pin)
+{
+    pio_sm_config c = pio_matrix_program_get_default_config(offset);
+    sm_config_set_set_pins(&c, pin, 1);
+    pio_gpio_init(pio, pin);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+    float div = clock_get_hz(clk_sys) / 8000000.0;
+    sm_config_set_clkdiv(&c, div);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_out_shift(&c, false, true, 24);
+    sm_config_set_out_special(&c, true, false, false);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host_hal.h"
+#include "hardware/i2c.h"
+#include "scheduler.h"
+#include "render_core.h"
+#include "input_events.h"
+#include "replay.h"
+#include "i2c_bus.h"
+#include "buttons.h"
+
+// Executor headless: roda o firmware contra a HAL de host com um roteiro de
+// entradas determinístico e relata as estatísticas ao fim do tempo virtual.
+//
+//   ProjetoIntegrado_host [--seconds N] [--seed N] [--dump] [--i2c-max HZ]
+//   ProjetoIntegrado_host --replay ARQUIVO [--repeat N]
+//
+// Com --replay o log de entradas (tools/replay_extract.py) é aplicado direto
+// à lógica do jogo, sem HAL nem tempo virtual, e o throughput é relatado.
+
+// Pinos e canais do firmware (ProjetoIntegrado.c)
+#define BUTTON_A_PIN 5
+#define JOYSTICK_BUTTON_PIN 22
+#define JOYSTICK_X_INPUT 1
+#define JOYSTICK_Y_INPUT 0
+
+#define BUTTON_HOLD_MS 60
+#define BUTTON_BOUNCES 4            // Repiques do contato em cada transição
+#define BUTTON_BOUNCE_US 300        // Intervalo entre repiques
+#define JOYSTICK_SEGMENT_MS 250     // Duração de cada movimento roteirizado
+#define JOYSTICK_NOISE 12           // Ruído de pico nas leituras do ADC
+
+int firmware_main(void);
+int32_t replay_game(const uint8_t *log, size_t len);
+
+static uint32_t seed = 1;
+static bool dump = false;
+static struct timespec wall_start;
+
+// ---------------------------------------------------------------- roteiro
+// Botões: pressiona em first_ms e, se period_ms != 0, repete a cada período.
+// Cada transição repica BUTTON_BOUNCES vezes antes de assentar.
+typedef struct {
+  uint pin;
+  uint32_t first_ms;
+  uint32_t period_ms;
+  bool pressed;
+  uint64_t next_ns;
+  uint64_t edge_ns;                 // Início da transição em curso
+  uint bounces;                     // Repiques restantes
+} button_script_t;
+
+static button_script_t buttons[] = {
+  {JOYSTICK_BUTTON_PIN, 500, 0, false, 0, 0, 0},   // Inicia o jogo
+  {BUTTON_A_PIN, 1000, 1500, false, 0, 0, 0},      // Reinicia após colisões
+};
+
+static uint64_t script_next(void) {
+  uint64_t next = UINT64_MAX;
+  for (uint i = 0; i < count_of(buttons); ++i)
+    if (buttons[i].next_ns < next)
+      next = buttons[i].next_ns;
+  return next;
+}
+
+static void script_run(uint64_t now) {
+  for (uint i = 0; i < count_of(buttons); ++i) {
+    button_script_t *button = &buttons[i];
+    if (button->next_ns > now)
+      continue;
+    bool contact;
+    if (button->bounces) {
+      button->bounces--;
+      contact = button->bounces % 2 ? !button->pressed : button->pressed;
+    } else {
+      button->pressed = !button->pressed;
+      button->edge_ns = button->next_ns;
+      button->bounces = BUTTON_BOUNCES;
+      contact = button->pressed;
+    }
+    host_gpio_set_input(button->pin, !contact);     // Botões ativos em nível baixo
+    if (button->bounces)
+      button->next_ns += (uint64_t) BUTTON_BOUNCE_US * 1000;
+    else if (button->pressed)
+      button->next_ns = button->edge_ns + (uint64_t) BUTTON_HOLD_MS * 1000000;
+    else if (button->period_ms)
+      button->next_ns = button->edge_ns + (uint64_t) (button->period_ms - BUTTON_HOLD_MS) * 1000000;
+    else
+      button->next_ns = UINT64_MAX;
+  }
+}
+
+static const host_event_source_t script_source = {script_next, script_run};
+
+static uint32_t hash32(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7feb352d;
+  x ^= x >> 15;
+  x *= 0x846ca68b;
+  x ^= x >> 16;
+  return x;
+}
+
+// Eixo X: esquerda, centro ou direita por segmento; eixo Y: onda triangular
+static uint16_t script_adc(uint input, uint64_t now_us) {
+  static uint32_t sample = 0;
+  int noise = (int) (hash32(seed ^ sample++) % (2 * JOYSTICK_NOISE + 1)) - JOYSTICK_NOISE;
+  int value;
+  if (input == JOYSTICK_X_INPUT) {
+    static const int positions[] = {400, 2048, 3700};
+    uint32_t segment = now_us / (JOYSTICK_SEGMENT_MS * 1000);
+    value = positions[hash32(seed * 2654435761u + segment) % 3];
+  } else {
+    uint32_t phase = (now_us / 1000) % 4000;
+    value = phase < 2000 ? phase * 4095 / 2000 : (4000 - phase) * 4095 / 2000;
+  }
+  value += noise;
+  return value < 0 ? 0 : value > 4095 ? 4095 : value;
+}
+
+// ---------------------------------------------------------------- relatório
+static void report(const char *reason) {
+  struct timespec wall_end;
+  clock_gettime(CLOCK_MONOTONIC, &wall_end);
+  double wall = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+  double virtual_s = host_now_ns() / 1e9;
+
+  const host_ssd1306_t *oled = host_ssd1306();
+  const host_ws2812_t *leds = host_ws2812();
+
+  fprintf(stderr, "\n== host run finished: %s ==\n", reason);
+  fprintf(stderr, "virtual %.3f s, wall %.3f s (%.0fx real time)\n", virtual_s, wall, wall > 0 ? virtual_s / wall : 0.0);
+  fprintf(stderr, "oled: %llu transactions, %llu bytes, %llu data bytes (%llu while scrolling), bus %u Hz\n",
+          (unsigned long long) oled->transactions, (unsigned long long) oled->bytes,
+          (unsigned long long) oled->data_bytes, (unsigned long long) oled->scroll_data_bytes, i2c1->baudrate);
+  i2c_bus_t *bus = i2c_bus_get(i2c1);
+  uint busy = i2c_bus_utilization_permille(bus);
+  fprintf(stderr, "i2c1: %u.%u%% busy, %lu preemptions\n", busy / 10, busy % 10, (unsigned long) bus->preemptions);
+  for (uint i = 0; i < bus->device_count; ++i) {
+    const i2c_device_t *device = bus->devices[i];
+    fprintf(stderr, "  0x%02x: %lu transfers, %lu words, latency avg %lu us max %lu us, %lu aborts\n", device->address,
+            (unsigned long) device->transfers, (unsigned long) device->words,
+            (unsigned long) (device->transfers ? device->latency_sum_us / device->transfers : 0),
+            (unsigned long) device->latency_max_us, (unsigned long) device->aborts);
+  }
+  fprintf(stderr, "ws2812: %llu frames, %llu words\n",
+          (unsigned long long) leds->frames, (unsigned long long) leds->words);
+  fprintf(stderr, "render: %lu dropped, %lu skipped\n",
+          (unsigned long) render_core_dropped(), (unsigned long) render_core_skipped());
+  fprintf(stderr, "input events: %lu dropped, worst latency %lu us\n",
+          (unsigned long) input_events_dropped(), (unsigned long) input_events_max_latency_us());
+  fprintf(stderr, "buttons: %llu edges on the pins, %lu interrupts\n",
+          (unsigned long long) host_gpio_input_edges(), (unsigned long) buttons_interrupts());
+  for (uint i = 0; i < scheduler_task_count(); ++i) {
+    task_t *task = scheduler_task(i);
+    fprintf(stderr, "task %-10s runs %8lu overruns %6lu max %6lu us\n", task->name,
+            (unsigned long) task->runs, (unsigned long) task->overruns, (unsigned long) task->max_runtime_us);
+  }
+
+  if (dump) {
+    host_ssd1306_dump(stderr);
+    if (host_ssd1306_at(HOST_SSD1306_ADDRESS + 1)->bytes)
+      host_ssd1306_dump_at(HOST_SSD1306_ADDRESS + 1, stderr);
+    // LEDs na ordem da cadeia, uma linha de MATRIX_WIDTH por vez
+    for (uint i = 0; i < leds->count; ++i)
+      fprintf(stderr, "%06lx%c", (unsigned long) (leds->leds[i] >> 8), (i + 1) % MATRIX_WIDTH ? ' ' : '\n');
+    fputc('\n', stderr);
+  }
+  replay_record_flush(); // Passos desde a última partida encerrada
+  fflush(stdout);
+}
+
+// ---------------------------------------------------------------- reprodução
+static int run_replay(const char *path, uint repeat) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+  static uint8_t log[1 << 20];
+  size_t len = fread(log, 1, sizeof(log), file);
+  fclose(file);
+
+  struct timespec start, end;
+  int64_t steps = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint i = 0; i < repeat; ++i) {
+    int32_t result = replay_game(log, len);
+    if (result < 0) {
+      fprintf(stderr, "%s: not a replay log\n", path);
+      return 1;
+    }
+    steps += result;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  fflush(stdout);
+
+  double wall = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  fprintf(stderr, "\n== replay finished ==\n");
+  fprintf(stderr, "log %zu bytes, %u run(s), %lld steps, wall %.3f s (%.0f steps/s)\n", len, repeat,
+          (long long) steps, wall, wall > 0 ? steps / wall : 0.0);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  double seconds = 60.0;
+  const char *replay = NULL;
+  uint repeat = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc)
+      seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--dump"))
+      dump = true;
+    else if (!strcmp(argv[i], "--i2c-max") && i + 1 < argc)
+      host_i2c_set_device_max_baudrate(strtoul(argv[++i], NULL, 0));
+    else if (!strcmp(argv[i], "--replay") && i + 1 < argc)
+      replay = argv[++i];
+    else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+      repeat = strtoul(argv[++i], NULL, 0);
+    else {
+      fprintf(stderr, "usage: %s [--seconds N] [--seed N] [--dump] [--i2c-max HZ] | --replay FILE [--repeat N]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (replay)
+    return run_replay(replay, repeat);
+
+  for (uint i = 0; i < count_of(buttons); ++i)
+    buttons[i].next_ns = (uint64_t) buttons[i].first_ms * 1000000;
+  host_register_source(&script_source);
+  host_adc_set_source(script_adc);
+  host_set_time_limit_us((uint64_t) (seconds * 1e6));
+  host_set_exit_handler(report);
+
+  clock_gettime(CLOCK_MONOTONIC, &wall_start);
+  return firmware_main();
+}
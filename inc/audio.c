@@ -0,0 +1,174 @@
+#include "audio.h"
+#include "hardware/pwm.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+#define AUDIO_QUEUE_MASK (AUDIO_QUEUE_LEN - 1)
+
+// Frequências nominais das notas; o PWM usa a mesma fórmula do código
+// original (divisor = clk_sys / (f * 4096), contador de 16 bits), o que
+// preserva o timbre dos efeitos
+static const uint16_t note_frequency[NOTE_COUNT] = {
+  [NOTE_REST] = 0,
+  [NOTE_DENIED] = 3300,
+  [NOTE_SUCCESS] = 4400,
+};
+
+typedef struct {
+  uint8_t div_int;
+  uint8_t div_frac;               // Dezesseis avos do divisor
+  uint16_t wrap;
+} audio_tone_t;
+
+typedef struct {
+  uint pin;
+  uint slice;
+  uint channel;
+  audio_event_t queue[AUDIO_QUEUE_LEN];
+  uint8_t head;                   // Escrita (audio_play)
+  uint8_t tail;                   // Leitura (alarme)
+  bool active;                    // Há um alarme agendado para esta voz
+  bool suspended;                 // PWM cedido a outro módulo (ex.: PCM); só os LEDs seguem a fila
+  uint8_t led;                    // LED aceso pelo evento atual
+} audio_voice_t;
+
+static audio_tone_t tones[NOTE_COUNT];
+static audio_voice_t voices[AUDIO_VOICES];
+
+static void audio_voice_init(audio_voice_t *voice, uint pin) {
+  voice->pin = pin;
+  voice->slice = pwm_gpio_to_slice_num(pin);
+  voice->channel = pwm_gpio_to_channel(pin);
+  voice->head = voice->tail = 0;
+  voice->active = false;
+  voice->suspended = false;
+  voice->led = AUDIO_NO_LED;
+
+  gpio_set_function(pin, GPIO_FUNC_PWM);
+  pwm_config config = pwm_get_default_config();
+  pwm_init(voice->slice, &config, true);
+  pwm_set_chan_level(voice->slice, voice->channel, 0);
+}
+
+void audio_init(uint pin_a, uint pin_b) {
+  uint32_t clock = clock_get_hz(clk_sys);
+  for (uint i = 1; i < NOTE_COUNT; ++i) {
+    // Divisor em dezesseis avos (formato 8.4 do PWM), arredondado
+    uint32_t div16 = (clock + note_frequency[i] * 128) / (note_frequency[i] * 256);
+    div16 = div16 < 16 ? 16 : div16 > 0xFFF ? 0xFFF : div16;
+    tones[i].div_int = div16 >> 4;
+    tones[i].div_frac = div16 & 0xF;
+    tones[i].wrap = 0xFFFF;
+  }
+  // Os dois buzzers ficam em slices diferentes (GPIO 10 -> 5A, GPIO 21 -> 2B),
+  // então cada voz ajusta divisor e wrap sem interferir na outra
+  audio_voice_init(&voices[AUDIO_VOICE_A], pin_a);
+  audio_voice_init(&voices[AUDIO_VOICE_B], pin_b);
+}
+
+// Aplica um evento: apenas escritas em registradores, seguro no contexto do alarme
+static void audio_apply(audio_voice_t *voice, const audio_event_t *event) {
+  if (voice->led != AUDIO_NO_LED)
+    gpio_put(voice->led, false);
+  voice->led = event->led;
+
+  if (voice->suspended) {
+    // Slice em uso por outro módulo: mantém apenas o tempo e os LEDs
+  } else if (event->note == NOTE_REST || event->note >= NOTE_COUNT) {
+    pwm_set_chan_level(voice->slice, voice->channel, 0);
+  } else {
+    const audio_tone_t *tone = &tones[event->note];
+    pwm_set_clkdiv_int_frac(voice->slice, tone->div_int, tone->div_frac);
+    pwm_set_wrap(voice->slice, tone->wrap);
+    pwm_set_chan_level(voice->slice, voice->channel, (tone->wrap >> 1) + 1);
+  }
+
+  if (voice->led != AUDIO_NO_LED)
+    gpio_put(voice->led, true);
+}
+
+static void audio_silence(audio_voice_t *voice) {
+  if (!voice->suspended)
+    pwm_set_chan_level(voice->slice, voice->channel, 0);
+  if (voice->led != AUDIO_NO_LED)
+    gpio_put(voice->led, false);
+  voice->led = AUDIO_NO_LED;
+}
+
+// Avança a fila da voz. Retorna o atraso negativo até o próximo evento,
+// relativo ao instante agendado (sem acumular atraso), ou 0 quando a fila acaba.
+static int64_t audio_advance(audio_voice_t *voice) {
+  if (voice->head == voice->tail) {
+    audio_silence(voice);
+    voice->active = false;
+    return 0;
+  }
+  audio_event_t event = voice->queue[voice->tail];
+  voice->tail = (voice->tail + 1) & AUDIO_QUEUE_MASK;
+  audio_apply(voice, &event);
+  return -(int64_t) MAX(event.duration_ms, 1) * 1000;
+}
+
+static int64_t audio_alarm_callback(alarm_id_t id, void *user_data) {
+  (void) id;
+  return audio_advance((audio_voice_t *) user_data);
+}
+
+// Enfileira um padrão de eventos e retorna imediatamente. Retorna false se
+// não houver espaço para o padrão inteiro.
+bool audio_play(uint voice_index, const audio_event_t *pattern, uint count) {
+  if (voice_index >= AUDIO_VOICES)
+    return false;
+  if (count == 0)
+    return true;
+  audio_voice_t *voice = &voices[voice_index];
+
+  uint32_t status = save_and_disable_interrupts();
+  uint used = (voice->head - voice->tail) & AUDIO_QUEUE_MASK;
+  if (count > AUDIO_QUEUE_LEN - 1u - used) {
+    restore_interrupts(status);
+    return false;
+  }
+  for (uint i = 0; i < count; ++i) {
+    voice->queue[voice->head] = pattern[i];
+    voice->head = (voice->head + 1) & AUDIO_QUEUE_MASK;
+  }
+  if (!voice->active) {
+    voice->active = true;
+    int64_t delay = audio_advance(voice);
+    add_alarm_in_us(-delay, audio_alarm_callback, voice, true);
+  }
+  restore_interrupts(status);
+  return true;
+}
+
+// Descarta os eventos pendentes; o evento atual termina no próximo alarme
+void audio_stop(uint voice_index) {
+  if (voice_index >= AUDIO_VOICES)
+    return;
+  audio_voice_t *voice = &voices[voice_index];
+  uint32_t status = save_and_disable_interrupts();
+  voice->tail = voice->head;
+  restore_interrupts(status);
+}
+
+bool audio_busy(uint voice_index) {
+  return voice_index < AUDIO_VOICES && voices[voice_index].active;
+}
+
+// Cede (ou devolve) o slice PWM da voz. Enquanto suspensa, a fila continua
+// avançando e acendendo LEDs, mas não altera o PWM.
+void audio_suspend(uint voice_index, bool suspended) {
+  if (voice_index >= AUDIO_VOICES)
+    return;
+  audio_voice_t *voice = &voices[voice_index];
+  uint32_t status = save_and_disable_interrupts();
+  voice->suspended = suspended;
+  if (!suspended)
+    pwm_set_chan_level(voice->slice, voice->channel, 0);
+  restore_interrupts(status);
+}
+
+uint audio_voice_pin(uint voice_index) {
+  return voices[voice_index].pin;
+}
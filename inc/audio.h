@@ -0,0 +1,39 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include "pico/stdlib.h"
+
+#define AUDIO_VOICES 2
+#define AUDIO_QUEUE_LEN 16        // Eventos por voz (potência de 2)
+#define AUDIO_NO_LED 0xFF
+
+enum {
+  AUDIO_VOICE_A = 0,              // Buzzer A
+  AUDIO_VOICE_B = 1               // Buzzer B
+};
+
+// Notas usadas pelo jogo. Os valores de PWM de cada uma são calculados uma
+// única vez em audio_init().
+typedef enum {
+  NOTE_REST = 0,                  // Silêncio
+  NOTE_DENIED,                    // Colisão
+  NOTE_SUCCESS,                   // Progressão de nível
+  NOTE_COUNT
+} audio_note_t;
+
+// Evento da fila: uma nota (ou pausa) com duração e um LED opcional aceso
+// enquanto o evento durar
+typedef struct {
+  uint8_t note;
+  uint8_t led;
+  uint16_t duration_ms;
+} audio_event_t;
+
+void audio_init(uint pin_a, uint pin_b);
+bool audio_play(uint voice, const audio_event_t *pattern, uint count);
+void audio_stop(uint voice);
+bool audio_busy(uint voice);
+void audio_suspend(uint voice, bool suspended);
+uint audio_voice_pin(uint voice);
+
+#endif
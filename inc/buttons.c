@@ -0,0 +1,60 @@
+#include "buttons.h"
+#include "hardware/irq.h"
+#include "buttons.pio.h"
+
+typedef struct {
+  uint pin;
+  uint sm;
+} button_t;
+
+static PIO buttons_pio;
+static uint program_offset;
+static buttons_callback_t buttons_callback;
+static button_t buttons[BUTTONS_MAX];
+static uint button_count;
+static volatile uint32_t interrupts;    // Só transições aceitas geram interrupção
+
+// Esvazia as FIFOs RX: cada palavra é uma transição já filtrada
+static void buttons_irq_handler(void) {
+  interrupts++;
+  for (uint i = 0; i < button_count; ++i) {
+    while (!pio_sm_is_rx_fifo_empty(buttons_pio, buttons[i].sm)) {
+      uint32_t level = pio_sm_get(buttons_pio, buttons[i].sm);
+      buttons_callback(buttons[i].pin, level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL);
+    }
+  }
+}
+
+void buttons_init(PIO pio, buttons_callback_t callback) {
+  buttons_pio = pio;
+  buttons_callback = callback;
+  button_count = 0;
+  program_offset = pio_add_program(pio, &button_debounce_program);
+
+  uint irq = pio_get_index(pio) ? PIO1_IRQ_0 : PIO0_IRQ_0;
+  irq_set_exclusive_handler(irq, buttons_irq_handler);
+  irq_set_enabled(irq, true);
+}
+
+// Dedica uma máquina de estado ao pino (entrada com pull-up, configurada
+// fora). Uma transição só vale depois de debounce_us no novo nível.
+// Retorna false se não houver máquina livre.
+bool buttons_add(uint pin, uint32_t debounce_us) {
+  if (button_count == BUTTONS_MAX)
+    return false;
+  int sm = pio_claim_unused_sm(buttons_pio, false);
+  if (sm < 0)
+    return false;
+
+  uint32_t samples = (uint64_t) debounce_us * BUTTONS_SAMPLE_HZ / 1000000;
+  button_debounce_program_init(buttons_pio, sm, program_offset, pin, BUTTONS_SAMPLE_HZ, MAX(samples, 1));
+  buttons[button_count].pin = pin;
+  buttons[button_count].sm = sm;
+  button_count++;
+  pio_set_irq0_source_enabled(buttons_pio, pis_sm0_rx_fifo_not_empty + sm, true);
+  return true;
+}
+
+uint32_t buttons_interrupts(void) {
+  return interrupts;
+}
@@ -0,0 +1,23 @@
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+// Botões lidos por máquinas de estado da PIO (buttons.pio), uma por pino.
+// Cada máquina amostra o pino a BUTTONS_SAMPLE_HZ e só aceita um novo nível
+// depois que ele se mantém pelo tempo de debounce daquele pino, então os
+// repiques do contato nunca chegam à CPU: cada pressão ou soltura real vira
+// uma palavra na FIFO RX e uma interrupção, entregue ao callback como borda.
+
+#define BUTTONS_MAX 4                   // Máquinas de estado de uma PIO
+#define BUTTONS_SAMPLE_HZ 10000         // Resolução de 100 us no tempo de debounce
+
+// events: GPIO_IRQ_EDGE_FALL ao pressionar, GPIO_IRQ_EDGE_RISE ao soltar
+typedef void (*buttons_callback_t)(uint pin, uint32_t events);
+
+void buttons_init(PIO pio, buttons_callback_t callback);
+bool buttons_add(uint pin, uint32_t debounce_us);
+uint32_t buttons_interrupts(void);
+
+#endif
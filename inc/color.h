@@ -0,0 +1,48 @@
+#ifndef COLOR_H
+#define COLOR_H
+
+#include <stdint.h>
+
+// Cor com 8 bits por canal (0 = apagado, 255 = intensidade máxima)
+typedef struct {
+  uint8_t R; // Intensidade da cor vermelha
+  uint8_t G; // Intensidade da cor verde
+  uint8_t B; // Intensidade da cor azul
+} RGB;
+
+#define COLOR_BRIGHTNESS_LEVELS 16
+
+// Correção gama ~2.2 aproximada por 0.8·t² + 0.2·t³ (t = x / 255). A expressão
+// é inteira e avaliada pelo compilador, então as tabelas já vão prontas para a flash.
+#define COLOR_GAMMA(x) ((4u * (x) * (x) * 255u + (x) * (x) * (x) + 162562u) / 325125u)
+#define COLOR_GAMMA_4(x) COLOR_GAMMA(x), COLOR_GAMMA((x) + 1), COLOR_GAMMA((x) + 2), COLOR_GAMMA((x) + 3)
+#define COLOR_GAMMA_16(x) COLOR_GAMMA_4(x), COLOR_GAMMA_4((x) + 4), COLOR_GAMMA_4((x) + 8), COLOR_GAMMA_4((x) + 12)
+#define COLOR_GAMMA_64(x) COLOR_GAMMA_16(x), COLOR_GAMMA_16((x) + 16), COLOR_GAMMA_16((x) + 32), COLOR_GAMMA_16((x) + 48)
+
+static const uint8_t color_gamma[256] = {
+  COLOR_GAMMA_64(0), COLOR_GAMMA_64(64), COLOR_GAMMA_64(128), COLOR_GAMMA_64(192)
+};
+
+// Fator de brilho global (0..256) para cada nível, na mesma curva perceptual
+#define COLOR_SCALE(level) ((COLOR_GAMMA((level) * 17u) * 256u + 127u) / 255u)
+
+static const uint16_t color_brightness[COLOR_BRIGHTNESS_LEVELS] = {
+  COLOR_SCALE(0), COLOR_SCALE(1), COLOR_SCALE(2), COLOR_SCALE(3),
+  COLOR_SCALE(4), COLOR_SCALE(5), COLOR_SCALE(6), COLOR_SCALE(7),
+  COLOR_SCALE(8), COLOR_SCALE(9), COLOR_SCALE(10), COLOR_SCALE(11),
+  COLOR_SCALE(12), COLOR_SCALE(13), COLOR_SCALE(14), COLOR_SCALE(15)
+};
+
+// Aplica gama e brilho a um canal: uma leitura de tabela e uma multiplicação inteira
+static inline uint8_t color_channel(uint8_t value, uint16_t scale) {
+  return (color_gamma[value] * scale) >> 8;
+}
+
+// Converte para a palavra GRB consumida pelo programa pio_matrix
+static inline uint32_t color_to_grb(RGB color, uint16_t scale) {
+  return ((uint32_t) color_channel(color.G, scale) << 24) |
+         ((uint32_t) color_channel(color.R, scale) << 16) |
+         ((uint32_t) color_channel(color.B, scale) << 8);
+}
+
+#endif
@@ -0,0 +1,168 @@
+#include "entities.h"
+#include <string.h>
+
+#define ENTITY_DEAD 0x80                // Marca em kind: removida na varredura seguinte
+#define ENTITY_CELL_SHIFT (ENTITY_SUBPIXEL_BITS + ENTITY_GRID_SHIFT)
+
+const uint8_t entity_size[ENTITY_KINDS][2] = {
+  [ENTITY_OBSTACLE] = {4, 4},
+  [ENTITY_PROJECTILE] = {1, 2},
+  [ENTITY_PARTICLE] = {1, 1},
+};
+
+void entities_init(entity_world_t *world) {
+  world->count = 0;
+  for (uint i = 0; i < ENTITY_CAPACITY; ++i)
+    world->slot[i] = i + 1;
+  world->slot[ENTITY_CAPACITY - 1] = ENTITY_NONE;
+  world->free_head = 0;
+  memset(world->cell_start, 0, sizeof(world->cell_start));
+}
+
+// Cria uma entidade; retorna ENTITY_NONE se o pool estiver cheio
+entity_id_t entities_spawn(entity_world_t *world, entity_kind_t kind, int16_t x, int16_t y, int16_t vx, int16_t vy, uint8_t ttl) {
+  entity_id_t id = world->free_head;
+  if (id == ENTITY_NONE)
+    return ENTITY_NONE;
+  world->free_head = world->slot[id];
+
+  uint i = world->count++;
+  world->x[i] = x;
+  world->y[i] = y;
+  world->vx[i] = vx;
+  world->vy[i] = vy;
+  world->kind[i] = kind;
+  world->ttl[i] = ttl;
+  world->id[i] = id;
+  world->slot[id] = i;
+  return id;
+}
+
+// Remove o índice denso i: a última entidade ocupa o lugar e o id volta à lista livre
+static void entities_remove_at(entity_world_t *world, uint i) {
+  entity_id_t id = world->id[i];
+  uint last = --world->count;
+  if (i != last) {
+    world->x[i] = world->x[last];
+    world->y[i] = world->y[last];
+    world->vx[i] = world->vx[last];
+    world->vy[i] = world->vy[last];
+    world->kind[i] = world->kind[last];
+    world->ttl[i] = world->ttl[last];
+    world->id[i] = world->id[last];
+    world->slot[world->id[i]] = i;
+  }
+  world->slot[id] = world->free_head;
+  world->free_head = id;
+}
+
+// Destruir um id inválido ou já destruído é erro de quem chama: falha no
+// assert e, sem ele, é ignorado em vez de remover outra entidade
+void entities_despawn(entity_world_t *world, entity_id_t id) {
+  bool alive = entities_alive(world, id);
+  hard_assert(alive);
+  if (alive)
+    entities_remove_at(world, world->slot[id]);
+}
+
+static inline int entities_clamp(int value, int max) {
+  return value < 0 ? 0 : value > max ? max : value;
+}
+
+// Refaz a grade com uma ordenação por contagem: dois passes lineares
+static void entities_build_grid(entity_world_t *world) {
+  uint16_t fill[ENTITY_GRID_CELLS];
+  memset(world->cell_start, 0, sizeof(world->cell_start));
+
+  for (uint i = 0; i < world->count; ++i) {
+    if (world->kind[i] != ENTITY_OBSTACLE)
+      continue;
+    uint8_t cell = entities_clamp(world->y[i] >> ENTITY_CELL_SHIFT, ENTITY_GRID_ROWS - 1) * ENTITY_GRID_COLS
+                 + entities_clamp(world->x[i] >> ENTITY_CELL_SHIFT, ENTITY_GRID_COLS - 1);
+    world->cell[i] = cell;
+    world->cell_start[cell + 1]++;
+  }
+  for (uint cell = 0; cell < ENTITY_GRID_CELLS; ++cell)
+    world->cell_start[cell + 1] += world->cell_start[cell];
+
+  memcpy(fill, world->cell_start, sizeof(fill));
+  for (uint i = 0; i < world->count; ++i) {
+    if (world->kind[i] == ENTITY_OBSTACLE)
+      world->cell_items[fill[world->cell[i]]++] = i;
+  }
+}
+
+// Um passo: move todas as entidades, remove as que saíram da tela (afastando-se
+// dela) ou cujo ttl acabou e refaz a grade. Retorna quantas continuam vivas.
+uint entities_update(entity_world_t *world) {
+  // De trás para frente: quem ocupa o lugar de uma removida já foi atualizada
+  for (int i = world->count - 1; i >= 0; --i) {
+    int16_t vx = world->vx[i], vy = world->vy[i];
+    int x = world->x[i] += vx;
+    int y = world->y[i] += vy;
+    const uint8_t *size = entity_size[world->kind[i]];
+
+    bool gone = (x + ENTITY_PX(size[0]) <= 0 && vx <= 0) || (x >= ENTITY_PX(ENTITY_FIELD_WIDTH) && vx >= 0) ||
+                (y + ENTITY_PX(size[1]) <= 0 && vy <= 0) || (y >= ENTITY_PX(ENTITY_FIELD_HEIGHT) && vy >= 0);
+    if (world->ttl[i] && --world->ttl[i] == 0)
+      gone = true;
+    if (gone)
+      entities_remove_at(world, i);
+  }
+  entities_build_grid(world);
+  return world->count;
+}
+
+// Primeiro obstáculo que se sobrepõe ao retângulo (unidades de posição), ou
+// ENTITY_NONE. Obstáculos ficam na célula do canto superior esquerdo, então a
+// busca começa ENTITY_MAX_SIZE pixels antes para pegar os que avançam sobre ela.
+entity_id_t entities_query(const entity_world_t *world, int16_t x, int16_t y, int16_t width, int16_t height) {
+  int cx0 = entities_clamp((x - ENTITY_PX(ENTITY_MAX_SIZE)) >> ENTITY_CELL_SHIFT, ENTITY_GRID_COLS - 1);
+  int cx1 = entities_clamp((x + width - 1) >> ENTITY_CELL_SHIFT, ENTITY_GRID_COLS - 1);
+  int cy0 = entities_clamp((y - ENTITY_PX(ENTITY_MAX_SIZE)) >> ENTITY_CELL_SHIFT, ENTITY_GRID_ROWS - 1);
+  int cy1 = entities_clamp((y + height - 1) >> ENTITY_CELL_SHIFT, ENTITY_GRID_ROWS - 1);
+  const int16_t size = ENTITY_PX(entity_size[ENTITY_OBSTACLE][0]);
+
+  for (int cy = cy0; cy <= cy1; ++cy) {
+    for (int cx = cx0; cx <= cx1; ++cx) {
+      uint cell = cy * ENTITY_GRID_COLS + cx;
+      for (uint k = world->cell_start[cell]; k < world->cell_start[cell + 1]; ++k) {
+        uint i = world->cell_items[k];
+        if (world->kind[i] != ENTITY_OBSTACLE)
+          continue;                 // Já atingido neste passo
+        if (world->x[i] < x + width && x < world->x[i] + size &&
+            world->y[i] < y + height && y < world->y[i] + size)
+          return world->id[i];
+      }
+    }
+  }
+  return ENTITY_NONE;
+}
+
+// Projéteis contra obstáculos pela grade: cada acerto destrói os dois.
+// Os atingidos são marcados e removidos numa única varredura no fim, para
+// que a grade continue válida durante as consultas. Retorna os acertos.
+uint entities_collide_projectiles(entity_world_t *world) {
+  uint hits = 0;
+  for (uint i = 0; i < world->count; ++i) {
+    if (world->kind[i] != ENTITY_PROJECTILE)
+      continue;
+    entity_id_t target = entities_query(world, world->x[i], world->y[i],
+                                        ENTITY_PX(entity_size[ENTITY_PROJECTILE][0]),
+                                        ENTITY_PX(entity_size[ENTITY_PROJECTILE][1]));
+    if (target == ENTITY_NONE)
+      continue;
+    world->kind[world->slot[target]] |= ENTITY_DEAD;
+    world->kind[i] |= ENTITY_DEAD;
+    hits++;
+  }
+
+  if (hits) {
+    for (int i = world->count - 1; i >= 0; --i) {
+      if (world->kind[i] & ENTITY_DEAD)
+        entities_remove_at(world, i);
+    }
+    entities_build_grid(world);
+  }
+  return hits;
+}
@@ -0,0 +1,79 @@
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+#include "pico/stdlib.h"
+
+// Entidades do modo de alta resolução (obstáculos, projéteis e partículas na
+// tela inteira do OLED). Tudo é alocado estaticamente: um pool de capacidade
+// fixa com lista livre de ids (criar e destruir em O(1)) e os atributos em
+// estrutura de arrays, densos, de modo que os passes de atualização e de
+// colisão percorrem memória contígua sem indireção.
+//
+// Posições e velocidades em 1/16 de pixel. A grade espacial (células de
+// 16x16 pixels) indexa só os obstáculos e é refeita a cada atualização.
+
+#define ENTITY_CAPACITY 512
+#define ENTITY_SUBPIXEL_BITS 4
+#define ENTITY_FIELD_WIDTH 128          // Pixels
+#define ENTITY_FIELD_HEIGHT 64
+#define ENTITY_GRID_SHIFT 4             // Células de 16x16 pixels
+#define ENTITY_GRID_COLS (ENTITY_FIELD_WIDTH >> ENTITY_GRID_SHIFT)
+#define ENTITY_GRID_ROWS (ENTITY_FIELD_HEIGHT >> ENTITY_GRID_SHIFT)
+#define ENTITY_GRID_CELLS (ENTITY_GRID_COLS * ENTITY_GRID_ROWS)
+#define ENTITY_MAX_SIZE 4               // Maior lado entre os tipos, em pixels
+#define ENTITY_NONE 0xFFFF
+
+// Converte pixels para a unidade das posições
+#define ENTITY_PX(px) ((int16_t) ((px) * (1 << ENTITY_SUBPIXEL_BITS)))
+
+typedef enum {
+  ENTITY_OBSTACLE,                // 4x4, colide com a nave e com projéteis
+  ENTITY_PROJECTILE,              // 1x2, destrói o obstáculo que atingir
+  ENTITY_PARTICLE,                // 1x1, só visual, some ao fim do ttl
+  ENTITY_KINDS
+} entity_kind_t;
+
+typedef uint16_t entity_id_t;
+
+extern const uint8_t entity_size[ENTITY_KINDS][2];  // Largura e altura em pixels
+
+typedef struct {
+  // Entidades vivas nos índices 0..count-1 (destruir move a última para o buraco)
+  int16_t x[ENTITY_CAPACITY];
+  int16_t y[ENTITY_CAPACITY];
+  int16_t vx[ENTITY_CAPACITY];
+  int16_t vy[ENTITY_CAPACITY];
+  uint8_t kind[ENTITY_CAPACITY];
+  uint8_t ttl[ENTITY_CAPACITY];         // Passos restantes (0 = sem limite)
+  entity_id_t id[ENTITY_CAPACITY];      // Id estável de cada índice denso
+  uint16_t count;
+
+  // Id -> índice denso para ids vivos; próximo da lista livre para os demais
+  uint16_t slot[ENTITY_CAPACITY];
+  entity_id_t free_head;
+
+  // Grade: obstáculos ordenados por célula (ordenação por contagem)
+  uint8_t cell[ENTITY_CAPACITY];
+  uint16_t cell_start[ENTITY_GRID_CELLS + 1];
+  uint16_t cell_items[ENTITY_CAPACITY];
+} entity_world_t;
+
+void entities_init(entity_world_t *world);
+entity_id_t entities_spawn(entity_world_t *world, entity_kind_t kind, int16_t x, int16_t y, int16_t vx, int16_t vy, uint8_t ttl);
+void entities_despawn(entity_world_t *world, entity_id_t id);
+uint entities_update(entity_world_t *world);
+entity_id_t entities_query(const entity_world_t *world, int16_t x, int16_t y, int16_t width, int16_t height);
+uint entities_collide_projectiles(entity_world_t *world);
+
+// O slot de um id livre guarda o encadeamento da lista livre e pode apontar
+// para outra entidade: só o id de volta no slot confirma que ele está vivo
+static inline bool entities_alive(const entity_world_t *world, entity_id_t id) {
+  return id < ENTITY_CAPACITY && world->slot[id] < world->count && world->id[world->slot[id]] == id;
+}
+
+// Índice denso de um id vivo (válido até a próxima destruição)
+static inline uint entities_index(const entity_world_t *world, entity_id_t id) {
+  return world->slot[id];
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include "pico/stdlib.h"
+#include "matrix_layout.h"
+
+// Dimensões do campo de jogo (uma célula por LED da matriz)
+#define PLAYFIELD_WIDTH MATRIX_WIDTH
+#define PLAYFIELD_HEIGHT MATRIX_HEIGHT
+#define SHIP_ROW (PLAYFIELD_HEIGHT - 1)
+
+// Definição dos componentes do jogo
+#define OBSTACLE 2
+#define SHIP 1
+#define EMPTY 0
+
+#include "playfield.h"
+
+// Gerador do jogo (xorshift32): a mesma semente produz a mesma sequência no
+// RP2040 e no host, o que a rand() da newlib e da glibc não garantem
+static inline uint32_t game_rand(uint32_t *state) {
+  uint32_t x = *state ? *state : 0x9E3779B9u; // Zero é ponto fixo do xorshift
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+// Cópia imutável do estado do jogo publicada para os renderizadores
+typedef struct {
+  uint32_t sequence;
+  uint32_t rows[PLAYFIELD_HEIGHT];  // Bitboards de obstáculos, topo primeiro
+  int ship_pos;
+  uint score;
+  uint speed;                       // Nível de velocidade exibido no HUD (1 = inicial)
+  bool collision;
+} game_snapshot_t;
+
+#endif
@@ -0,0 +1,275 @@
+#include "i2c_bus.h"
+#include <string.h>
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "profiler.h"
+
+#define I2C_BUS_COUNT 2
+
+static i2c_bus_t buses[I2C_BUS_COUNT];
+static spin_lock_t *bus_lock;       // Fila compartilhada entre os núcleos e as interrupções
+
+static void i2c_bus_dispatch(i2c_bus_t *bus);
+
+// Barramento parado: FIFO vazia e nenhum byte ou STOP em andamento
+static inline bool i2c_bus_idle(i2c_hw_t *hw) {
+  return (hw->status & I2C_IC_STATUS_TFE_BITS) && !(hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+// Insere por prioridade. Uma transferência interrompida volta à frente das
+// de mesma prioridade (continua de onde parou); uma nova vai para o fim.
+static void i2c_bus_enqueue(i2c_bus_t *bus, i2c_transfer_t *transfer, bool resume) {
+  i2c_transfer_t **link = &bus->queue;
+  while (*link && ((*link)->priority > transfer->priority || (!resume && (*link)->priority == transfer->priority)))
+    link = &(*link)->next;
+  transfer->next = *link;
+  *link = transfer;
+}
+
+// Tamanho do próximo trecho: até a primeira palavra com STOP, inclusive
+static uint32_t i2c_bus_segment_length(const i2c_transfer_t *transfer) {
+  uint32_t end = transfer->offset;
+  while (end + 1 < transfer->len && !(transfer->words[end] & I2C_IC_DATA_CMD_STOP_BITS))
+    ++end;
+  return end + 1 - transfer->offset;
+}
+
+// Fim de um trecho: o STOP já saiu no fio, ou houve um abort (causa em
+// abort_source, bits de IC_TX_ABRT_SOURCE). Um abort encerra a
+// transferência inteira como falha. Contabiliza e passa ao próximo trecho;
+// retorna a transferência concluída, cujo aviso sai fora da trava.
+static i2c_transfer_t *i2c_bus_segment_done(i2c_bus_t *bus, bool aborted, uint32_t abort_source) {
+  i2c_transfer_t *transfer = bus->active;
+  i2c_device_t *device = transfer->device;
+  uint64_t now = time_us_64();
+  uint32_t spent = now - bus->segment_start_us;
+  bus->active = NULL;
+  i2c_get_hw(bus->i2c)->intr_mask &= ~(I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS);
+  bus->busy_us += spent;
+  device->busy_us += spent;
+  PROFILE_BUS_ADD(PROFILE_BUS_I2C, spent);
+
+  i2c_transfer_t *finished = NULL;
+  if (aborted) {
+    device->aborts++;
+    device->last_abort_source = abort_source;
+    transfer->failed = true;
+    transfer->pending = false;
+    finished = transfer;
+  } else {
+    device->words += bus->segment_len;
+    transfer->offset += bus->segment_len;
+    if (transfer->offset < transfer->len) {
+      i2c_bus_enqueue(bus, transfer, true);
+      if (bus->queue != transfer)
+        bus->preemptions++;
+    } else {
+      uint32_t latency = now - transfer->submitted_us;
+      device->transfers++;
+      device->latency_sum_us += latency;
+      if (latency > device->latency_max_us)
+        device->latency_max_us = latency;
+      transfer->pending = false;
+      finished = transfer;
+    }
+  }
+  i2c_bus_dispatch(bus);
+  return finished;
+}
+
+// Com a trava: inicia o próximo trecho da cabeça da fila, se houver
+static void i2c_bus_dispatch(i2c_bus_t *bus) {
+  i2c_transfer_t *transfer = bus->queue;
+  if (bus->locked || !transfer)
+    return;
+
+  i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+  if (hw->tar != transfer->device->address) {
+    // O endereço só muda com o controlador parado. Se a FIFO ainda tem
+    // palavras do dispositivo anterior, retoma na interrupção TX_EMPTY.
+    if (!i2c_bus_idle(hw)) {
+      bus->waiting_idle = true;
+      hw->tx_tl = 0;
+      hw->intr_mask |= I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+      return;
+    }
+    hw->enable = 0;
+    hw->tar = transfer->device->address;
+    hw->enable = 1;
+  }
+  if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
+    (void) hw->clr_tx_abrt;
+  (void) hw->clr_stop_det;
+  // STOP_DET e TX_ABRT só ficam habilitados com um trecho em trânsito: fora
+  // dele quem os consome são as escritas bloqueantes do SDK
+  hw->intr_mask |= I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+  bus->queue = transfer->next;
+  bus->active = transfer;
+  bus->segment_len = i2c_bus_segment_length(transfer);
+  bus->segment_start_us = time_us_64();
+  dma_channel_transfer_from_buffer_now(bus->dma_channel, &transfer->words[transfer->offset], bus->segment_len);
+}
+
+static void i2c_bus_notify(i2c_transfer_t *transfer) {
+  if (transfer && transfer->done)
+    transfer->done(transfer, transfer->user_data);
+}
+
+// Interrupção do controlador I2C:
+// - TX_ABRT: o dispositivo recusou (NAK) ou o barramento foi perdido. O
+//   controlador descarta a FIFO; o DMA do trecho é abortado e a causa fica
+//   registrada no dispositivo.
+// - STOP_DET com o DMA terminado: o último byte e o STOP do trecho saíram no
+//   fio. Só aqui o trecho conta como concluído, com o tempo real de barramento.
+// - TX_EMPTY antes da troca de endereço: falta no máximo o último byte e o
+//   STOP no fio, então a espera aqui é de alguns microssegundos.
+static void i2c_bus_i2c_irq_handler(void) {
+  for (uint i = 0; i < I2C_BUS_COUNT; ++i) {
+    i2c_bus_t *bus = &buses[i];
+    if (!bus->i2c)
+      continue;
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+    i2c_transfer_t *finished = NULL;
+    uint32_t status = spin_lock_blocking(bus_lock);
+    if (bus->active) {
+      uint32_t raw = hw->raw_intr_stat;
+      if (raw & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        uint32_t source = hw->tx_abrt_source;
+        dma_channel_abort(bus->dma_channel);
+        (void) hw->clr_tx_abrt;
+        (void) hw->clr_stop_det;
+        while (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)
+          tight_loop_contents();
+        finished = i2c_bus_segment_done(bus, true, source);
+      } else if ((raw & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) && !dma_channel_is_busy(bus->dma_channel)) {
+        (void) hw->clr_stop_det;
+        while (!i2c_bus_idle(hw))
+          tight_loop_contents();
+        finished = i2c_bus_segment_done(bus, false, 0);
+      }
+    } else if (bus->waiting_idle && (hw->status & I2C_IC_STATUS_TFE_BITS)) {
+      while (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)
+        tight_loop_contents();
+      hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+      bus->waiting_idle = false;
+      i2c_bus_dispatch(bus);
+    }
+    spin_unlock(bus_lock, status);
+    i2c_bus_notify(finished);
+  }
+}
+
+// Escalonador do barramento de uma instância I2C, criado no primeiro uso.
+// O i2c_init() da instância continua a cargo da aplicação.
+i2c_bus_t *i2c_bus_get(i2c_inst_t *i2c) {
+  i2c_bus_t *bus = &buses[i2c_hw_index(i2c)];
+  if (bus->i2c)
+    return bus;
+
+  if (!bus_lock)
+    bus_lock = spin_lock_instance(spin_lock_claim_unused(true));
+  memset(bus, 0, sizeof(*bus));
+  bus->i2c = i2c;
+  bus->since_us = time_us_64();
+
+  bus->dma_channel = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(bus->dma_channel);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+  dma_channel_configure(bus->dma_channel, &c, &i2c_get_hw(i2c)->data_cmd, NULL, 0, false);
+
+  // O fim de cada trecho vem do controlador (STOP_DET), não do DMA: o DMA
+  // termina quando a última palavra entra na FIFO, bytes antes do STOP
+  uint irq = I2C0_IRQ + i2c_hw_index(i2c);
+  i2c_get_hw(i2c)->intr_mask &= ~(I2C_IC_INTR_MASK_M_TX_EMPTY_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS |
+                                  I2C_IC_INTR_MASK_M_TX_ABRT_BITS);
+  irq_set_exclusive_handler(irq, i2c_bus_i2c_irq_handler);
+  irq_set_enabled(irq, true);
+  return bus;
+}
+
+void i2c_bus_add_device(i2c_bus_t *bus, i2c_device_t *device, uint8_t address) {
+  memset(device, 0, sizeof(*device));
+  device->bus = bus;
+  device->address = address;
+  if (bus->device_count < I2C_BUS_MAX_DEVICES)
+    bus->devices[bus->device_count++] = device;
+}
+
+void i2c_transfer_init(i2c_transfer_t *transfer, i2c_device_t *device, i2c_transfer_done_t done, void *user_data) {
+  memset(transfer, 0, sizeof(*transfer));
+  transfer->device = device;
+  transfer->done = done;
+  transfer->user_data = user_data;
+}
+
+// Enfileira as palavras (que devem continuar válidas até o fim) sem
+// bloquear. Retorna false se a transferência ainda estiver pendente.
+bool i2c_bus_submit(i2c_transfer_t *transfer, const uint16_t *words, uint32_t len, uint8_t priority) {
+  if (transfer->pending)
+    return false;
+  if (len == 0)
+    return true;
+  i2c_bus_t *bus = transfer->device->bus;
+  transfer->words = words;
+  transfer->len = len;
+  transfer->offset = 0;
+  transfer->priority = priority;
+  transfer->submitted_us = time_us_64();
+  transfer->failed = false;
+  transfer->pending = true;
+
+  uint32_t status = spin_lock_blocking(bus_lock);
+  i2c_bus_enqueue(bus, transfer, false);
+  if (!bus->active && !bus->waiting_idle)
+    i2c_bus_dispatch(bus);
+  spin_unlock(bus_lock, status);
+  return true;
+}
+
+// Reserva o barramento para escritas bloqueantes (comandos, sondagem): o
+// trecho em trânsito termina, a FIFO esvazia e a fila fica parada até
+// i2c_bus_release. Transferências interrompidas param num STOP.
+void i2c_bus_acquire(i2c_bus_t *bus) {
+  uint32_t status = spin_lock_blocking(bus_lock);
+  bus->locked = true;
+  spin_unlock(bus_lock, status);
+
+  i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+  while (bus->active || bus->waiting_idle || !i2c_bus_idle(hw))
+    tight_loop_contents();
+  if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
+    (void) hw->clr_tx_abrt;
+}
+
+void i2c_bus_release(i2c_bus_t *bus) {
+  uint32_t status = spin_lock_blocking(bus_lock);
+  bus->locked = false;
+  i2c_bus_dispatch(bus);
+  spin_unlock(bus_lock, status);
+}
+
+// Fração do tempo com trechos em trânsito desde i2c_bus_reset_stats
+uint i2c_bus_utilization_permille(i2c_bus_t *bus) {
+  uint64_t elapsed = time_us_64() - bus->since_us;
+  return elapsed ? bus->busy_us * 1000 / elapsed : 0;
+}
+
+void i2c_bus_reset_stats(i2c_bus_t *bus) {
+  uint32_t status = spin_lock_blocking(bus_lock);
+  bus->busy_us = 0;
+  bus->since_us = time_us_64();
+  bus->preemptions = 0;
+  for (uint i = 0; i < bus->device_count; ++i) {
+    i2c_device_t *device = bus->devices[i];
+    device->transfers = device->words = 0;
+    device->busy_us = device->latency_sum_us = 0;
+    device->latency_max_us = 0;
+    device->aborts = 0;
+  }
+  spin_unlock(bus_lock, status);
+}
@@ -0,0 +1,96 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+// Escalonador de transações de um barramento I2C compartilhado. Cada
+// dispositivo (painéis SSD1306 ou outro periférico) entrega transferências
+// prontas em palavras IC_DATA_CMD; elas entram numa fila por prioridade e
+// são enviadas uma atrás da outra por um único canal de DMA, sem a CPU.
+//
+// Cada transferência é enviada em trechos que terminam num STOP. Entre um
+// trecho e outro o barramento pode passar a uma transferência de prioridade
+// maior de outro dispositivo: um HUD pequeno num painel não espera o fim de
+// um quadro inteiro no outro.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define I2C_BUS_MAX_DEVICES 4
+
+#define I2C_PRIORITY_BULK 0       // Quadros grandes
+#define I2C_PRIORITY_NORMAL 1
+#define I2C_PRIORITY_URGENT 2     // Atualizações pequenas sensíveis à latência
+
+typedef struct i2c_bus i2c_bus_t;
+typedef struct i2c_transfer i2c_transfer_t;
+typedef void (*i2c_transfer_done_t)(i2c_transfer_t *transfer, void *user_data);
+
+// Dispositivo no barramento, com as estatísticas das suas transferências
+typedef struct {
+  i2c_bus_t *bus;
+  uint8_t address;
+  uint32_t transfers;               // Transferências concluídas
+  uint32_t words;                   // Palavras enviadas
+  uint64_t busy_us;                 // Tempo de barramento ocupado
+  uint64_t latency_sum_us;          // Da submissão ao STOP do último trecho
+  uint32_t latency_max_us;
+  uint32_t aborts;                  // Transferências recusadas (NAK, perda de arbitragem)
+  uint32_t last_abort_source;       // IC_TX_ABRT_SOURCE do último abort
+} i2c_device_t;
+
+struct i2c_transfer {
+  i2c_device_t *device;
+  const uint16_t *words;            // Palavras IC_DATA_CMD (bit STOP nas fronteiras)
+  uint32_t len;
+  uint32_t offset;                  // Próxima palavra a enviar
+  uint8_t priority;
+  volatile bool pending;            // Na fila ou em trânsito
+  volatile bool failed;             // Encerrada por um abort; o restante não foi enviado
+  uint64_t submitted_us;
+  i2c_transfer_done_t done;         // Chamado na interrupção após o STOP do último trecho ou um abort
+  void *user_data;
+  i2c_transfer_t *next;             // Fila (lista intrusiva, sem alocação)
+};
+
+struct i2c_bus {
+  i2c_inst_t *i2c;
+  int dma_channel;
+  i2c_device_t *devices[I2C_BUS_MAX_DEVICES];
+  uint device_count;
+  i2c_transfer_t *queue;            // Ordenada por prioridade, FIFO entre iguais
+  i2c_transfer_t *volatile active;  // Dona do trecho em trânsito
+  uint32_t segment_len;
+  uint64_t segment_start_us;
+  volatile bool waiting_idle;       // Esperando o barramento esvaziar para trocar de endereço
+  bool locked;                      // Reservado para uma escrita bloqueante
+  uint32_t preemptions;             // Trocas para uma transferência mais prioritária
+  uint64_t busy_us;                 // Tempo ocupado desde since_us
+  uint64_t since_us;
+};
+
+i2c_bus_t *i2c_bus_get(i2c_inst_t *i2c);
+void i2c_bus_add_device(i2c_bus_t *bus, i2c_device_t *device, uint8_t address);
+void i2c_transfer_init(i2c_transfer_t *transfer, i2c_device_t *device, i2c_transfer_done_t done, void *user_data);
+bool i2c_bus_submit(i2c_transfer_t *transfer, const uint16_t *words, uint32_t len, uint8_t priority);
+void i2c_bus_acquire(i2c_bus_t *bus);
+void i2c_bus_release(i2c_bus_t *bus);
+uint i2c_bus_utilization_permille(i2c_bus_t *bus);
+void i2c_bus_reset_stats(i2c_bus_t *bus);
+
+static inline bool i2c_transfer_busy(const i2c_transfer_t *transfer) {
+  return transfer->pending;
+}
+
+// Última transferência concluída terminou num abort
+static inline bool i2c_transfer_failed(const i2c_transfer_t *transfer) {
+  return transfer->failed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
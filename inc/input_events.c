@@ -0,0 +1,53 @@
+#include "input_events.h"
+#include "hardware/sync.h"
+
+// Anel produtor único (IRQ dos botões) / consumidor único (laço principal).
+// A interrupção só grava o evento e avança head; toda a lógica do jogo roda
+// fora dela, ao esvaziar o anel.
+
+#define INPUT_EVENTS_MASK (INPUT_EVENTS_LEN - 1)
+
+static input_event_t ring[INPUT_EVENTS_LEN];
+static volatile uint32_t head = 0;          // Escrito apenas pela IRQ
+static volatile uint32_t tail = 0;          // Escrito apenas pelo consumidor
+static volatile uint32_t dropped = 0;       // Eventos perdidos com o anel cheio
+static uint32_t max_latency_us = 0;         // Pior atraso entre a IRQ e o tratamento
+
+// Chamada na interrupção: registra o evento sem bloquear
+void input_events_push(uint pin, uint32_t events) {
+  uint32_t h = head;
+  if (h - tail >= INPUT_EVENTS_LEN) {
+    dropped++;
+    return;
+  }
+  input_event_t *event = &ring[h & INPUT_EVENTS_MASK];
+  event->timestamp_us = time_us_64();
+  event->pin = pin;
+  event->edge = events;
+  __dmb();
+  head = h + 1;
+}
+
+// Retira o evento mais antigo; retorna false se o anel estiver vazio
+bool input_events_pop(input_event_t *event) {
+  uint32_t t = tail;
+  if (t == head)
+    return false;
+  __dmb();
+  *event = ring[t & INPUT_EVENTS_MASK];
+  __dmb();
+  tail = t + 1;
+
+  uint32_t latency = time_us_64() - event->timestamp_us;
+  if (latency > max_latency_us)
+    max_latency_us = latency;
+  return true;
+}
+
+uint32_t input_events_dropped(void) {
+  return dropped;
+}
+
+uint32_t input_events_max_latency_us(void) {
+  return max_latency_us;
+}
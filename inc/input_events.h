@@ -0,0 +1,20 @@
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include "pico/stdlib.h"
+
+#define INPUT_EVENTS_LEN 16       // Capacidade do anel (potência de 2)
+
+// Evento compacto gerado na interrupção dos botões
+typedef struct {
+  uint64_t timestamp_us;          // time_us_64() no momento da interrupção
+  uint8_t pin;
+  uint8_t edge;                   // GPIO_IRQ_EDGE_FALL (pressão) ou _RISE (soltura)
+} input_event_t;
+
+void input_events_push(uint pin, uint32_t events);
+bool input_events_pop(input_event_t *event);
+uint32_t input_events_dropped(void);
+uint32_t input_events_max_latency_us(void);
+
+#endif
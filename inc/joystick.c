@@ -0,0 +1,136 @@
+#include "joystick.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+
+// Captura contínua: o ADC alterna entre os dois canais (round-robin) e o DMA
+// esvazia a FIFO em um anel alinhado. Um segundo canal de DMA apenas recarrega
+// o contador do primeiro, de modo que a captura nunca para e não gera IRQ.
+// joystick_update() decima o anel, filtra e publica o resultado em uma única
+// palavra de 32 bits, lida por joystick_get_filtered().
+
+#define JOYSTICK_ADC_CLOCK 48000000
+#define JOYSTICK_IIR_SHIFT 2        // Passa-baixas de primeira ordem após a decimação
+#define JOYSTICK_TRACK_SHIFT 6      // Acompanhamento lento do centro dentro da zona morta
+
+volatile joystick_state_t joystick_filtered = {{JOYSTICK_CENTER, JOYSTICK_CENTER}};
+
+static uint16_t ring[JOYSTICK_RING_SAMPLES] __attribute__((aligned(1 << JOYSTICK_RING_BITS)));
+static const uint32_t reload_count = JOYSTICK_RING_SAMPLES;
+static int data_channel;
+static bool x_is_odd;                   // O eixo X ocupa as posições ímpares do anel
+
+// Estado do filtro por eixo (valores em Q3: 12 bits << 3)
+typedef struct {
+  int32_t filtered;
+  int32_t center;
+  int32_t center_sum;
+  int32_t min;
+  int32_t max;
+  int32_t deadzone;
+} axis_t;
+
+static axis_t axes[2];                  // 0: canal menor, 1: canal maior
+static uint32_t updates;
+
+// Função para iniciar a captura contínua dos dois eixos
+void joystick_init(uint x_input, uint y_input) {
+  uint first = x_input < y_input ? x_input : y_input;
+  x_is_odd = x_input > y_input;
+
+  adc_select_input(first);
+  adc_set_round_robin((1u << x_input) | (1u << y_input));
+  adc_fifo_setup(true, true, 1, false, false);
+  adc_set_clkdiv(JOYSTICK_ADC_CLOCK / (JOYSTICK_SAMPLE_RATE * 2) - 1);
+
+  data_channel = dma_claim_unused_channel(true);
+  int control_channel = dma_claim_unused_channel(true);
+
+  dma_channel_config c = dma_channel_get_default_config(data_channel);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, false);
+  channel_config_set_write_increment(&c, true);
+  channel_config_set_ring(&c, true, JOYSTICK_RING_BITS);
+  channel_config_set_dreq(&c, DREQ_ADC);
+  channel_config_set_chain_to(&c, control_channel);
+  dma_channel_configure(data_channel, &c, ring, &adc_hw->fifo, JOYSTICK_RING_SAMPLES, false);
+
+  dma_channel_config r = dma_channel_get_default_config(control_channel);
+  channel_config_set_transfer_data_size(&r, DMA_SIZE_32);
+  channel_config_set_read_increment(&r, false);
+  channel_config_set_write_increment(&r, false);
+  dma_channel_configure(
+    control_channel,
+    &r,
+    &dma_channel_hw_addr(data_channel)->al1_transfer_count_trig,
+    &reload_count,
+    1,
+    false
+  );
+
+  for (int i = 0; i < 2; ++i) {
+    axes[i].filtered = JOYSTICK_CENTER << 3;
+    axes[i].center = JOYSTICK_CENTER << 3;
+    axes[i].center_sum = 0;
+    axes[i].min = INT32_MAX;
+    axes[i].max = INT32_MIN;
+    axes[i].deadzone = JOYSTICK_MIN_DEADZONE << 3;
+  }
+  updates = 0;
+
+  dma_channel_start(data_channel);
+  adc_run(true);
+}
+
+// Aplica o filtro a um eixo e devolve o valor centrado em JOYSTICK_CENTER
+static uint16_t joystick_axis_update(axis_t *axis, int32_t sum) {
+  if (updates == 0)
+    axis->filtered = sum;
+  axis->filtered += (sum - axis->filtered) >> JOYSTICK_IIR_SHIFT;
+
+  if (updates < JOYSTICK_CALIBRATION_UPDATES) {
+    axis->center_sum += axis->filtered;
+    if (axis->filtered < axis->min) axis->min = axis->filtered;
+    if (axis->filtered > axis->max) axis->max = axis->filtered;
+    return JOYSTICK_CENTER;
+  }
+
+  int32_t deviation = axis->filtered - axis->center;
+  if (deviation > -axis->deadzone && deviation < axis->deadzone) {
+    axis->center += deviation >> JOYSTICK_TRACK_SHIFT;
+    return JOYSTICK_CENTER;
+  }
+
+  int32_t value = JOYSTICK_CENTER + (deviation >> 3);
+  return value < 0 ? 0 : value > 4095 ? 4095 : value;
+}
+
+// Decima as amostras mais recentes do anel e atualiza a leitura filtrada
+void joystick_update(void) {
+  uint32_t written = (dma_channel_hw_addr(data_channel)->write_addr - (uintptr_t)ring) / sizeof(ring[0]);
+  uint32_t end = written & ~1u;         // Apenas pares completos (canal menor, canal maior)
+
+  int32_t sums[2] = {0, 0};
+  for (uint32_t i = 0; i < JOYSTICK_OVERSAMPLE; ++i) {
+    uint32_t pair = (end - 2 * (i + 1)) & (JOYSTICK_RING_SAMPLES - 1);
+    sums[0] += ring[pair] & 0xFFF;
+    sums[1] += ring[pair + 1] & 0xFFF;
+  }
+
+  uint16_t lo = joystick_axis_update(&axes[0], sums[0]);
+  uint16_t hi = joystick_axis_update(&axes[1], sums[1]);
+
+  if (updates < JOYSTICK_CALIBRATION_UPDATES && ++updates == JOYSTICK_CALIBRATION_UPDATES) {
+    // Fim da calibração: centro médio em repouso e zona morta acima do ruído medido
+    for (int i = 0; i < 2; ++i) {
+      axes[i].center = axes[i].center_sum / JOYSTICK_CALIBRATION_UPDATES;
+      axes[i].deadzone = 2 * (axes[i].max - axes[i].min);
+      if (axes[i].deadzone < (JOYSTICK_MIN_DEADZONE << 3))
+        axes[i].deadzone = JOYSTICK_MIN_DEADZONE << 3;
+    }
+  }
+
+  joystick_state_t state;
+  state.x = x_is_odd ? hi : lo;
+  state.y = x_is_odd ? lo : hi;
+  joystick_filtered.packed = state.packed;
+}
@@ -0,0 +1,35 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include "pico/stdlib.h"
+
+#define JOYSTICK_SAMPLE_RATE 4000       // Amostras por segundo em cada eixo
+#define JOYSTICK_RING_BITS 7            // Anel de 2^7 bytes = 64 amostras de 16 bits
+#define JOYSTICK_RING_SAMPLES ((1 << JOYSTICK_RING_BITS) / 2)
+#define JOYSTICK_OVERSAMPLE 8           // Pares de amostras somados por decimação
+#define JOYSTICK_CALIBRATION_UPDATES 100 // Atualizações iniciais usadas para medir o centro em repouso
+#define JOYSTICK_MIN_DEADZONE 48        // Zona morta mínima (escala de 12 bits)
+#define JOYSTICK_CENTER 2048
+
+// Leitura filtrada dos dois eixos, já centrada em JOYSTICK_CENTER
+typedef union {
+  struct {
+    uint16_t x;
+    uint16_t y;
+  };
+  uint32_t packed;
+} joystick_state_t;
+
+extern volatile joystick_state_t joystick_filtered;
+
+void joystick_init(uint x_input, uint y_input);
+void joystick_update(void);
+
+// Última leitura filtrada: uma única leitura de 32 bits da memória
+static inline joystick_state_t joystick_get_filtered(void) {
+  joystick_state_t state;
+  state.packed = joystick_filtered.packed;
+  return state;
+}
+
+#endif
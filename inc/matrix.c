@@ -0,0 +1,106 @@
+#include "matrix.h"
+#include <string.h>
+#include "hardware/irq.h"
+#include "ws2812.pio.h"
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+static matrix_t *profiled_matrix;
+
+// Fim do DMA: a última palavra entrou na FIFO da PIO. O resto do quadro (as
+// palavras na FIFO e no OSR) e o reset têm tempo de linha fixo e entram como
+// estimativa; o tempo até aqui é medido.
+static void matrix_dma_irq_handler(void) {
+  matrix_t *matrix = profiled_matrix;
+  if (!dma_channel_get_irq0_status(matrix->dma_channel))
+    return;
+  dma_channel_acknowledge_irq0(matrix->dma_channel);
+  PROFILE_BUS_END(PROFILE_BUS_PIO);
+  PROFILE_BUS_ADD(PROFILE_BUS_PIO, (pio_sm_get_tx_fifo_level(matrix->pio, matrix->sm) + 1) * MATRIX_BIT_US + MATRIX_RESET_US);
+}
+#endif
+
+void matrix_init(matrix_t *matrix, PIO pio, uint pin) {
+  matrix->pio = pio;
+  uint offset = pio_add_program(pio, &pio_matrix_program);
+  matrix->sm = pio_claim_unused_sm(pio, true);
+  pio_matrix_program_init(pio, matrix->sm, offset, pin);
+
+  matrix->dma_channel = dma_claim_unused_channel(true);
+  dma_channel_config c = dma_channel_get_default_config(matrix->dma_channel);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, pio_get_dreq(pio, matrix->sm, true));
+  dma_channel_configure(
+    matrix->dma_channel,
+    &c,
+    &pio->txf[matrix->sm],
+    matrix->front,
+    MATRIX_NUM_PIXELS,
+    false
+  );
+#if PROFILER_ENABLED
+  profiled_matrix = matrix;
+  dma_channel_set_irq0_enabled(matrix->dma_channel, true);
+  irq_add_shared_handler(DMA_IRQ_0, matrix_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
+#endif
+
+  memset(matrix->pixels, 0, sizeof(matrix->pixels));
+  matrix->shown = false;
+  matrix->ready_at = get_absolute_time();
+  matrix_set_brightness(matrix, MATRIX_DEFAULT_BRIGHTNESS);
+}
+
+// Ajusta o brilho global (0 .. COLOR_BRIGHTNESS_LEVELS - 1); vale a partir
+// do próximo quadro convertido com matrix_color()
+void matrix_set_brightness(matrix_t *matrix, uint8_t level) {
+  if (level >= COLOR_BRIGHTNESS_LEVELS)
+    level = COLOR_BRIGHTNESS_LEVELS - 1;
+  matrix->scale = color_brightness[level];
+}
+
+void matrix_set_pixel(matrix_t *matrix, uint index, uint32_t grb) {
+  if (index < MATRIX_NUM_PIXELS)
+    matrix->pixels[index] = grb;
+}
+
+void matrix_fill(matrix_t *matrix, uint32_t grb) {
+  for (uint i = 0; i < MATRIX_NUM_PIXELS; ++i)
+    matrix->pixels[i] = grb;
+}
+
+// Indica se o quadro anterior ainda está sendo transmitido ou travado
+bool matrix_busy(matrix_t *matrix) {
+  return dma_channel_is_busy(matrix->dma_channel) || !time_reached(matrix->ready_at);
+}
+
+// Envia o framebuffer por DMA sem bloquear. Se nada mudou desde o último
+// quadro a transferência é omitida; se o anterior ainda estiver em curso,
+// retorna false e o quadro fica pendente para a próxima chamada.
+bool matrix_show(matrix_t *matrix) {
+  if (matrix->shown && memcmp(matrix->pixels, matrix->front, sizeof(matrix->front)) == 0)
+    return true;
+  if (matrix_busy(matrix))
+    return false;
+
+  memcpy(matrix->front, matrix->pixels, sizeof(matrix->front));
+  matrix->shown = true;
+  // O tempo de linha da PIO é fixo: o fim do quadro é conhecido de antemão
+  matrix->ready_at = make_timeout_time_us(MATRIX_NUM_PIXELS * MATRIX_BIT_US + MATRIX_RESET_US);
+  PROFILE_BUS_BEGIN(PROFILE_BUS_PIO);
+  dma_channel_transfer_from_buffer_now(matrix->dma_channel, matrix->front, MATRIX_NUM_PIXELS);
+  return true;
+}
+
+void matrix_wait(matrix_t *matrix) {
+  while (matrix_busy(matrix))
+    tight_loop_contents();
+}
+
+void matrix_show_blocking(matrix_t *matrix) {
+  matrix_wait(matrix);
+  matrix_show(matrix);
+  matrix_wait(matrix);
+}
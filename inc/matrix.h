@@ -0,0 +1,46 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "color.h"
+#include "matrix_layout.h"
+
+#define MATRIX_BIT_US 30          // 24 bits a 800 kHz por LED
+#define MATRIX_RESET_US 300       // Intervalo em nível baixo para travar os dados (WS2812B)
+#define MATRIX_DEFAULT_BRIGHTNESS 8
+
+// Matriz WS2812 alimentada por DMA a partir de um framebuffer GRB empacotado
+// (G << 24 | R << 16 | B << 8, na ordem em que os LEDs estão encadeados)
+typedef struct {
+  PIO pio;
+  uint sm;
+  int dma_channel;
+  uint32_t pixels[MATRIX_NUM_PIXELS];   // Back buffer: alterado pelo jogo
+  uint32_t front[MATRIX_NUM_PIXELS];    // Front buffer: último quadro enviado
+  bool shown;                           // front contém um quadro válido
+  absolute_time_t ready_at;             // Fim da transmissão + reset do último quadro
+  uint16_t scale;                       // Fator de brilho atual (color_brightness)
+} matrix_t;
+
+void matrix_init(matrix_t *matrix, PIO pio, uint pin);
+void matrix_set_pixel(matrix_t *matrix, uint index, uint32_t grb);
+
+// Escreve o pixel lógico (x, y): uma leitura da tabela de mapeamento
+static inline void matrix_set_xy(matrix_t *matrix, uint x, uint y, uint32_t grb) {
+  matrix->pixels[matrix_map[y * MATRIX_WIDTH + x]] = grb;
+}
+void matrix_fill(matrix_t *matrix, uint32_t grb);
+bool matrix_show(matrix_t *matrix);
+bool matrix_busy(matrix_t *matrix);
+void matrix_wait(matrix_t *matrix);
+void matrix_show_blocking(matrix_t *matrix);
+void matrix_set_brightness(matrix_t *matrix, uint8_t level);
+
+// Converte uma cor lógica para a palavra GRB com o brilho atual da matriz
+static inline uint32_t matrix_color(const matrix_t *matrix, RGB color) {
+  return color_to_grb(color, matrix->scale);
+}
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef MATRIX_LAYOUT_H
+#define MATRIX_LAYOUT_H
+
+#include <stdint.h>
+
+// Geometria da matriz de LEDs. Todos os valores podem ser redefinidos na
+// compilação (ex.: -DMATRIX_PANEL_WIDTH=8) para painéis 8x8, 16x16 ou vários
+// painéis encadeados; o padrão é a matriz 5x5 da BitDogLab.
+#ifndef MATRIX_PANEL_WIDTH
+#define MATRIX_PANEL_WIDTH 5      // Colunas de cada painel
+#endif
+#ifndef MATRIX_PANEL_HEIGHT
+#define MATRIX_PANEL_HEIGHT 5     // Linhas de cada painel
+#endif
+#ifndef MATRIX_SERPENTINE
+#define MATRIX_SERPENTINE 1       // 1: linhas alternam o sentido; 0: todas no mesmo sentido
+#endif
+#ifndef MATRIX_ROTATION
+#define MATRIX_ROTATION 2         // Rotação do painel em quartos de volta (sentido horário)
+#endif
+#ifndef MATRIX_TILES_X
+#define MATRIX_TILES_X 1          // Painéis por linha
+#endif
+#ifndef MATRIX_TILES_Y
+#define MATRIX_TILES_Y 1          // Linhas de painéis
+#endif
+#ifndef MATRIX_TILE_SERPENTINE
+#define MATRIX_TILE_SERPENTINE 0  // 1: linhas de painéis alternam o sentido do encadeamento
+#endif
+
+#define MATRIX_WIDTH (MATRIX_PANEL_WIDTH * MATRIX_TILES_X)
+#define MATRIX_HEIGHT (MATRIX_PANEL_HEIGHT * MATRIX_TILES_Y)
+#define MATRIX_PANEL_PIXELS (MATRIX_PANEL_WIDTH * MATRIX_PANEL_HEIGHT)
+#define MATRIX_NUM_PIXELS (MATRIX_WIDTH * MATRIX_HEIGHT)
+
+#if (MATRIX_ROTATION & 1) && MATRIX_PANEL_WIDTH != MATRIX_PANEL_HEIGHT
+#error "Rotações de 90/270 graus exigem painéis quadrados"
+#endif
+#if MATRIX_NUM_PIXELS > 1024
+#error "A tabela de mapeamento suporta no máximo 1024 LEDs"
+#endif
+
+// Coordenada lógica (x, y) do pixel i, e sua posição dentro do painel
+#define MATRIX_X(i) ((i) % MATRIX_WIDTH)
+#define MATRIX_Y(i) ((i) / MATRIX_WIDTH)
+#define MATRIX_LX(i) (MATRIX_X(i) % MATRIX_PANEL_WIDTH)
+#define MATRIX_LY(i) (MATRIX_Y(i) % MATRIX_PANEL_HEIGHT)
+
+// Posição física no painel após a rotação
+#define MATRIX_PX(i) (MATRIX_ROTATION == 0 ? MATRIX_LX(i) : \
+                      MATRIX_ROTATION == 1 ? MATRIX_PANEL_WIDTH - 1 - MATRIX_LY(i) : \
+                      MATRIX_ROTATION == 2 ? MATRIX_PANEL_WIDTH - 1 - MATRIX_LX(i) : MATRIX_LY(i))
+#define MATRIX_PY(i) (MATRIX_ROTATION == 0 ? MATRIX_LY(i) : \
+                      MATRIX_ROTATION == 1 ? MATRIX_LX(i) : \
+                      MATRIX_ROTATION == 2 ? MATRIX_PANEL_HEIGHT - 1 - MATRIX_LY(i) : MATRIX_PANEL_HEIGHT - 1 - MATRIX_LX(i))
+
+// Ordem do LED dentro do painel e do painel dentro da cadeia
+#define MATRIX_PANEL_INDEX(i) (MATRIX_PY(i) * MATRIX_PANEL_WIDTH + \
+    ((MATRIX_SERPENTINE && (MATRIX_PY(i) & 1)) ? MATRIX_PANEL_WIDTH - 1 - MATRIX_PX(i) : MATRIX_PX(i)))
+#define MATRIX_TILE_X(i) (MATRIX_X(i) / MATRIX_PANEL_WIDTH)
+#define MATRIX_TILE_Y(i) (MATRIX_Y(i) / MATRIX_PANEL_HEIGHT)
+#define MATRIX_TILE_INDEX(i) (MATRIX_TILE_Y(i) * MATRIX_TILES_X + \
+    ((MATRIX_TILE_SERPENTINE && (MATRIX_TILE_Y(i) & 1)) ? MATRIX_TILES_X - 1 - MATRIX_TILE_X(i) : MATRIX_TILE_X(i)))
+
+#define MATRIX_INDEX(i) (MATRIX_TILE_INDEX(i) * MATRIX_PANEL_PIXELS + MATRIX_PANEL_INDEX(i))
+
+#define MATRIX_MAP_4(i) MATRIX_INDEX(i), MATRIX_INDEX((i) + 1), MATRIX_INDEX((i) + 2), MATRIX_INDEX((i) + 3)
+#define MATRIX_MAP_16(i) MATRIX_MAP_4(i), MATRIX_MAP_4((i) + 4), MATRIX_MAP_4((i) + 8), MATRIX_MAP_4((i) + 12)
+#define MATRIX_MAP_64(i) MATRIX_MAP_16(i), MATRIX_MAP_16((i) + 16), MATRIX_MAP_16((i) + 32), MATRIX_MAP_16((i) + 48)
+
+// Tabela posição lógica (y * MATRIX_WIDTH + x) -> posição do LED na cadeia,
+// calculada pelo compilador. Entradas além de MATRIX_NUM_PIXELS são apenas
+// preenchimento até o próximo múltiplo de 64.
+#define MATRIX_MAP_SIZE (((MATRIX_NUM_PIXELS) + 63) / 64 * 64)
+
+static const uint16_t matrix_map[MATRIX_MAP_SIZE] = {
+  MATRIX_MAP_64(0),
+#if MATRIX_NUM_PIXELS > 64
+  MATRIX_MAP_64(64),
+#endif
+#if MATRIX_NUM_PIXELS > 128
+  MATRIX_MAP_64(128),
+#endif
+#if MATRIX_NUM_PIXELS > 192
+  MATRIX_MAP_64(192),
+#endif
+#if MATRIX_NUM_PIXELS > 256
+  MATRIX_MAP_64(256),
+#endif
+#if MATRIX_NUM_PIXELS > 320
+  MATRIX_MAP_64(320),
+#endif
+#if MATRIX_NUM_PIXELS > 384
+  MATRIX_MAP_64(384),
+#endif
+#if MATRIX_NUM_PIXELS > 448
+  MATRIX_MAP_64(448),
+#endif
+#if MATRIX_NUM_PIXELS > 512
+  MATRIX_MAP_64(512),
+#endif
+#if MATRIX_NUM_PIXELS > 576
+  MATRIX_MAP_64(576),
+#endif
+#if MATRIX_NUM_PIXELS > 640
+  MATRIX_MAP_64(640),
+#endif
+#if MATRIX_NUM_PIXELS > 704
+  MATRIX_MAP_64(704),
+#endif
+#if MATRIX_NUM_PIXELS > 768
+  MATRIX_MAP_64(768),
+#endif
+#if MATRIX_NUM_PIXELS > 832
+  MATRIX_MAP_64(832),
+#endif
+#if MATRIX_NUM_PIXELS > 896
+  MATRIX_MAP_64(896),
+#endif
+#if MATRIX_NUM_PIXELS > 960
+  MATRIX_MAP_64(960),
+#endif
+};
+
+#endif
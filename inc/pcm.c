@@ -0,0 +1,156 @@
+#include "pcm.h"
+#include "audio.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+
+// Reprodução PCM no pino de um buzzer: o slice PWM roda com wrap 255
+// (portadora de ~488 kHz a 125 MHz) e um par de canais DMA encadeados,
+// cadenciados por um timer de DMA, escreve uma amostra por período no
+// registrador de comparação. A CPU só participa uma vez por bloco, para
+// mixar os efeitos ativos no bloco que acabou de tocar.
+
+typedef struct {
+  const pcm_sample_t *sample;
+  uint32_t position;
+  bool loop;
+} pcm_channel_t;
+
+static uint pcm_voice;
+static uint pcm_slice;
+static int dma_timer;
+static int dma_block[2];
+static uint16_t block[2][PCM_BLOCK_SAMPLES];
+static int16_t mix[PCM_BLOCK_SAMPLES];
+static pcm_channel_t channels[PCM_CHANNELS];
+static volatile bool running = false;
+static uint8_t silent_blocks;
+
+// Mixa os canais ativos em um bloco. Retorna false se o bloco ficou mudo.
+static bool pcm_fill(uint16_t *out) {
+  bool audible = false;
+  for (uint i = 0; i < PCM_BLOCK_SAMPLES; ++i)
+    mix[i] = 0;
+
+  for (uint c = 0; c < PCM_CHANNELS; ++c) {
+    pcm_channel_t *channel = &channels[c];
+    if (!channel->sample)
+      continue;
+    audible = true;
+    const uint8_t *data = channel->sample->data;
+    uint32_t length = channel->sample->length;
+    for (uint i = 0; i < PCM_BLOCK_SAMPLES; ++i) {
+      if (channel->position >= length) {
+        if (!channel->loop) {
+          channel->sample = NULL;
+          break;
+        }
+        channel->position = 0;
+      }
+      mix[i] += (int16_t) data[channel->position++] - 128;
+    }
+  }
+
+  for (uint i = 0; i < PCM_BLOCK_SAMPLES; ++i) {
+    int16_t value = mix[i] + 128;
+    out[i] = value < 0 ? 0 : value > 255 ? 255 : value;
+  }
+  return audible;
+}
+
+static void pcm_shutdown(void) {
+  dma_channel_abort(dma_block[0]);
+  dma_channel_abort(dma_block[1]);
+  pwm_set_chan_level(pcm_slice, pwm_gpio_to_channel(audio_voice_pin(pcm_voice)), 0);
+  audio_suspend(pcm_voice, false);
+  running = false;
+}
+
+// Um bloco terminou (o outro já está tocando): remixa e rearma o canal
+static void pcm_dma_irq_handler(void) {
+  for (uint b = 0; b < 2; ++b) {
+    if (!dma_channel_get_irq0_status(dma_block[b]))
+      continue;
+    dma_channel_acknowledge_irq0(dma_block[b]);
+    if (!running)
+      continue;
+
+    // Dois blocos mudos seguidos: o último som já saiu, desliga a saída
+    silent_blocks = pcm_fill(block[b]) ? 0 : silent_blocks + 1;
+    if (silent_blocks >= 2) {
+      pcm_shutdown();
+      return;
+    }
+    dma_channel_set_read_addr(dma_block[b], block[b], false);
+  }
+}
+
+static void pcm_dma_configure(uint b, volatile void *cc) {
+  dma_channel_config c = dma_channel_get_default_config(dma_block[b]);
+  // Escritas de 16 bits são replicadas nas duas metades de CC: a amostra
+  // vale para o canal A e o B do slice
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, dma_get_timer_dreq(dma_timer));
+  channel_config_set_chain_to(&c, dma_block[b ^ 1]);
+  dma_channel_configure(dma_block[b], &c, cc, block[b], PCM_BLOCK_SAMPLES, false);
+  dma_channel_set_irq0_enabled(dma_block[b], true);
+}
+
+// Associa o motor PCM ao buzzer de uma voz do sequenciador de tons
+void pcm_init(uint voice) {
+  pcm_voice = voice;
+  pcm_slice = pwm_gpio_to_slice_num(audio_voice_pin(voice));
+
+  dma_timer = dma_claim_unused_timer(true);
+  dma_timer_set_fraction(dma_timer, 1, clock_get_hz(clk_sys) / PCM_SAMPLE_RATE);
+
+  dma_block[0] = dma_claim_unused_channel(true);
+  dma_block[1] = dma_claim_unused_channel(true);
+  pcm_dma_configure(0, &pwm_hw->slice[pcm_slice].cc);
+  pcm_dma_configure(1, &pwm_hw->slice[pcm_slice].cc);
+
+  irq_add_shared_handler(DMA_IRQ_0, pcm_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
+}
+
+// Inicia um efeito em um canal do mixer (substitui o que estiver tocando nele)
+bool pcm_play(uint channel, const pcm_sample_t *sample, bool loop) {
+  if (channel >= PCM_CHANNELS || !sample || sample->length == 0)
+    return false;
+
+  uint32_t status = save_and_disable_interrupts();
+  channels[channel].sample = sample;
+  channels[channel].position = 0;
+  channels[channel].loop = loop;
+  silent_blocks = 0;
+
+  if (!running) {
+    // Toma o slice do sequenciador de tons e troca para a portadora de áudio
+    audio_suspend(pcm_voice, true);
+    pwm_set_clkdiv_int_frac(pcm_slice, 1, 0);
+    pwm_set_wrap(pcm_slice, 255);
+    pcm_fill(block[0]);
+    pcm_fill(block[1]);
+    dma_channel_set_read_addr(dma_block[1], block[1], false);
+    running = true;
+    dma_channel_set_read_addr(dma_block[0], block[0], true);
+  }
+  restore_interrupts(status);
+  return true;
+}
+
+void pcm_stop(uint channel) {
+  if (channel >= PCM_CHANNELS)
+    return;
+  uint32_t status = save_and_disable_interrupts();
+  channels[channel].sample = NULL;
+  restore_interrupts(status);
+}
+
+bool pcm_active(void) {
+  return running;
+}
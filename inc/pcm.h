@@ -0,0 +1,21 @@
+#ifndef PCM_H
+#define PCM_H
+
+#include "pico/stdlib.h"
+
+#define PCM_SAMPLE_RATE 8000
+#define PCM_BLOCK_SAMPLES 256     // Amostras por bloco do ping-pong (32 ms a 8 kHz)
+#define PCM_CHANNELS 2            // Efeitos que podem ser mixados ao mesmo tempo
+
+// Amostras PCM de 8 bits sem sinal (silêncio = 128), normalmente em flash
+typedef struct {
+  const uint8_t *data;
+  uint32_t length;
+} pcm_sample_t;
+
+void pcm_init(uint voice);
+bool pcm_play(uint channel, const pcm_sample_t *sample, bool loop);
+void pcm_stop(uint channel);
+bool pcm_active(void);
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef PLAYFIELD_H
+#define PLAYFIELD_H
+
+#include "pico/stdlib.h"
+
+// Campo de jogo em bitboards: uma palavra de 32 bits por linha (bit x = coluna x)
+// guardada em um anel de linhas. Descer todos os obstáculos é só mover o índice
+// da linha do topo, colisão é um AND e criar um obstáculo é ligar um bit, com
+// custo constante para qualquer largura até 32 colunas.
+
+#define PLAYFIELD_MAX_WIDTH 32
+
+typedef struct {
+  uint32_t rows[PLAYFIELD_HEIGHT];  // Obstáculos, em anel
+  uint8_t top;                      // Posição no anel da linha 0 (topo)
+} playfield_t;
+
+_Static_assert(PLAYFIELD_WIDTH <= PLAYFIELD_MAX_WIDTH, "playfield wider than a bitboard row");
+
+#define PLAYFIELD_ROW_MASK ((uint32_t)(((uint64_t)1 << PLAYFIELD_WIDTH) - 1))
+
+// Índice no anel da linha lógica y
+static inline uint playfield_slot(const playfield_t *field, uint y) {
+  uint slot = field->top + y;
+  return slot >= PLAYFIELD_HEIGHT ? slot - PLAYFIELD_HEIGHT : slot;
+}
+
+static inline uint32_t playfield_row(const playfield_t *field, uint y) {
+  return field->rows[playfield_slot(field, y)];
+}
+
+static inline void playfield_clear(playfield_t *field) {
+  for (uint y = 0; y < PLAYFIELD_HEIGHT; ++y)
+    field->rows[y] = 0;
+  field->top = 0;
+}
+
+// Cria um obstáculo na coluna x da linha do topo
+static inline void playfield_spawn(playfield_t *field, uint x) {
+  field->rows[field->top] |= 1u << x;
+}
+
+static inline bool playfield_obstacle_at(const playfield_t *field, uint x, uint y) {
+  return playfield_row(field, y) & (1u << x);
+}
+
+// Desce todos os obstáculos uma linha. Os que saem pela linha de baixo somem,
+// exceto o que estiver sob keep_mask (obstáculo que já atingiu a nave).
+// Retorna os obstáculos que acabaram de chegar à linha de baixo.
+static inline uint32_t playfield_advance(playfield_t *field, uint32_t keep_mask) {
+  uint bottom = playfield_slot(field, PLAYFIELD_HEIGHT - 1);
+  uint32_t kept = field->rows[bottom] & keep_mask;
+  field->rows[bottom] = 0;
+  field->top = bottom;              // A antiga linha de baixo vira o novo topo
+  uint new_bottom = playfield_slot(field, PLAYFIELD_HEIGHT - 1);
+  uint32_t arrived = field->rows[new_bottom];
+  field->rows[new_bottom] = arrived | kept;
+  return arrived;
+}
+
+// Copia as linhas em ordem lógica (topo primeiro)
+static inline void playfield_copy_rows(const playfield_t *field, uint32_t rows[PLAYFIELD_HEIGHT]) {
+  for (uint y = 0; y < PLAYFIELD_HEIGHT; ++y)
+    rows[y] = playfield_row(field, y);
+}
+
+#endif
@@ -0,0 +1,168 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+#include "hardware/sync.h"
+
+volatile uint32_t profiler_zone_us[PROFILE_ZONES];
+volatile uint32_t profiler_bus_us[PROFILE_BUSES];
+
+static volatile uint32_t bus_start[PROFILE_BUSES];
+
+// Registros de quadro: escritos por quem fecha o quadro (núcleo do render),
+// lidos pela tarefa de telemetria no núcleo 0
+static profile_frame_t ring[PROFILER_RING_LEN];
+static volatile uint32_t ring_head = 0;
+static uint32_t ring_tail = 0;
+
+static uint32_t hist_frame[PROFILER_HIST_BUCKETS];
+static uint32_t hist_bus[PROFILE_BUSES][PROFILER_HIST_BUCKETS];
+
+static uint32_t last_frame_at;
+static uint32_t last_zone[PROFILE_ZONES];
+static uint32_t last_bus[PROFILE_BUSES];
+
+static uint16_t telemetry_seq = 0;
+
+void profiler_bus_begin(profile_bus_t bus) {
+  bus_start[bus] = time_us_32();
+}
+
+void profiler_bus_end(profile_bus_t bus) {
+  profiler_bus_us[bus] += time_us_32() - bus_start[bus];
+}
+
+void profiler_bus_add(profile_bus_t bus, uint32_t us) {
+  profiler_bus_us[bus] += us;
+}
+
+static inline uint16_t clamp_u16(uint32_t value) {
+  return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+static inline void histogram_add(uint32_t *hist, uint32_t value, uint32_t bucket_us) {
+  uint32_t bucket = value / bucket_us;
+  hist[bucket < PROFILER_HIST_BUCKETS ? bucket : PROFILER_HIST_BUCKETS - 1]++;
+}
+
+// Fecha o quadro: grava o tempo de cada zona e barramento desde o quadro
+// anterior no anel e atualiza os histogramas
+void profiler_frame_end(void) {
+  uint32_t now = time_us_32();
+  uint32_t head = ring_head;
+  profile_frame_t *record = &ring[head % PROFILER_RING_LEN];
+
+  record->frame = head;
+  record->frame_us = head ? now - last_frame_at : 0;
+  last_frame_at = now;
+  for (int i = 0; i < PROFILE_ZONES; i++) {
+    uint32_t total = profiler_zone_us[i];
+    record->zone_us[i] = clamp_u16(total - last_zone[i]);
+    last_zone[i] = total;
+  }
+  for (int i = 0; i < PROFILE_BUSES; i++) {
+    uint32_t total = profiler_bus_us[i];
+    record->bus_us[i] = clamp_u16(total - last_bus[i]);
+    last_bus[i] = total;
+    histogram_add(hist_bus[i], record->bus_us[i], PROFILER_BUS_BUCKET_US);
+  }
+  // O primeiro quadro não tem anterior e ficaria fora da escala
+  if (head > 0)
+    histogram_add(hist_frame, record->frame_us, PROFILER_FRAME_BUCKET_US);
+
+  __dmb();
+  ring_head = head + 1;
+}
+
+const profile_frame_t *profiler_last_frame(void) {
+  uint32_t head = ring_head;
+  return head ? &ring[(head - 1) % PROFILER_RING_LEN] : NULL;
+}
+
+// Envio cru: o stdio USB converteria '\n' em "\r\n" dentro da carga
+static void send_packet(uint8_t type, const uint8_t *payload, uint8_t len) {
+  uint8_t sum1 = type, sum2 = type;
+  sum1 = (sum1 + len) % 255;
+  sum2 = (sum2 + sum1) % 255;
+  for (uint i = 0; i < len; i++) {
+    sum1 = (sum1 + payload[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+
+  putchar_raw(PROFILER_MAGIC0);
+  putchar_raw(PROFILER_MAGIC1);
+  putchar_raw(type);
+  putchar_raw(len);
+  for (uint i = 0; i < len; i++)
+    putchar_raw(payload[i]);
+  putchar_raw(sum1);
+  putchar_raw(sum2);
+}
+
+static uint8_t *put_u16(uint8_t *out, uint32_t value) {
+  value = clamp_u16(value);
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+  return out + 2;
+}
+
+// Resumo dos quadros fechados desde o último pacote: contagem, tempo médio
+// e máximo do quadro, média de cada zona e de cada barramento
+static void send_summary(void) {
+  uint32_t head = ring_head;
+  __dmb();
+  uint32_t frames = head - ring_tail;
+  // Se a telemetria atrasou mais que o anel, só os registros ainda válidos contam
+  if (frames > PROFILER_RING_LEN - 1)
+    ring_tail = head - (PROFILER_RING_LEN - 1);
+
+  uint32_t count = head - ring_tail;
+  uint32_t frame_sum = 0, frame_max = 0;
+  uint32_t zone_sum[PROFILE_ZONES] = {0};
+  uint32_t bus_sum[PROFILE_BUSES] = {0};
+  for (; ring_tail != head; ring_tail++) {
+    const profile_frame_t *record = &ring[ring_tail % PROFILER_RING_LEN];
+    frame_sum += record->frame_us;
+    if (record->frame_us > frame_max)
+      frame_max = record->frame_us;
+    for (int i = 0; i < PROFILE_ZONES; i++)
+      zone_sum[i] += record->zone_us[i];
+    for (int i = 0; i < PROFILE_BUSES; i++)
+      bus_sum[i] += record->bus_us[i];
+  }
+  uint32_t div = count ? count : 1;
+
+  uint8_t payload[2 * (4 + PROFILE_ZONES + PROFILE_BUSES)];
+  uint8_t *out = payload;
+  out = put_u16(out, telemetry_seq);
+  out = put_u16(out, frames);
+  out = put_u16(out, frame_sum / div);
+  out = put_u16(out, frame_max);
+  for (int i = 0; i < PROFILE_ZONES; i++)
+    out = put_u16(out, zone_sum[i] / div);
+  for (int i = 0; i < PROFILE_BUSES; i++)
+    out = put_u16(out, bus_sum[i] / div);
+  send_packet(PROFILER_PACKET_SUMMARY, payload, out - payload);
+}
+
+// Histogramas acumulados desde a inicialização (contagens saturam em 65535)
+static void send_histograms(void) {
+  uint8_t payload[2 + 2 * PROFILER_HIST_BUCKETS * (1 + PROFILE_BUSES)];
+  uint8_t *out = put_u16(payload, telemetry_seq);
+  for (int i = 0; i < PROFILER_HIST_BUCKETS; i++)
+    out = put_u16(out, hist_frame[i]);
+  for (int bus = 0; bus < PROFILE_BUSES; bus++)
+    for (int i = 0; i < PROFILER_HIST_BUCKETS; i++)
+      out = put_u16(out, hist_bus[bus][i]);
+  send_packet(PROFILER_PACKET_HISTOGRAM, payload, out - payload);
+}
+
+// Tarefa periódica (PROFILER_TELEMETRY_HZ): decodificada por tools/telemetry_decode.py
+void profiler_telemetry_task(void) {
+  send_summary();
+  if (telemetry_seq % PROFILER_HIST_EVERY == 0)
+    send_histograms();
+  telemetry_seq++;
+}
+
+#endif
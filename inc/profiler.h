@@ -0,0 +1,94 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "pico/stdlib.h"
+
+// Instrumentação por quadro. Com PROFILER_ENABLED = 0 (padrão) todas as
+// macros PROFILE_* viram nada e o módulo não gera código.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 0
+#endif
+
+#define PROFILER_RING_LEN 32          // Registros de quadro guardados (potência de 2)
+#define PROFILER_HIST_BUCKETS 16
+#define PROFILER_FRAME_BUCKET_US 2000 // Histograma do tempo de quadro: 0..32 ms
+#define PROFILER_BUS_BUCKET_US 1000   // Histogramas de ocupação I2C/PIO: 0..16 ms
+#ifndef PROFILER_TELEMETRY_HZ
+#define PROFILER_TELEMETRY_HZ 10      // Pacotes de resumo por segundo
+#endif
+#define PROFILER_HIST_EVERY 10        // Um pacote de histogramas a cada N resumos
+
+// Pacote de telemetria (little-endian), intercalado com o texto do printf:
+//   0xA5 0x5A | tipo | tamanho | carga (tamanho bytes) | Fletcher-16 (tipo..carga)
+#define PROFILER_MAGIC0 0xA5
+#define PROFILER_MAGIC1 0x5A
+#define PROFILER_PACKET_SUMMARY 1
+#define PROFILER_PACKET_HISTOGRAM 2
+
+typedef enum {
+  PROFILE_INPUT,    // Botões e filtro do joystick
+  PROFILE_LOGIC,    // Passo da simulação
+  PROFILE_MATRIX,   // Desenho da matriz de LEDs
+  PROFILE_OLED,     // Desenho no back buffer do OLED
+  PROFILE_FLUSH,    // Montagem e disparo do envio do OLED
+  PROFILE_IDLE,     // Núcleo 0 dormindo em __wfe
+  PROFILE_ZONES
+} profile_zone_t;
+
+typedef enum {
+  PROFILE_BUS_I2C,  // Trechos em trânsito no barramento do OLED (i2c_bus)
+  PROFILE_BUS_PIO,  // Matriz WS2812: DMA medido até a interrupção, mais FIFO e reset estimados
+  PROFILE_BUSES
+} profile_bus_t;
+
+typedef struct {
+  uint32_t frame;
+  uint32_t frame_us;                  // Intervalo desde o quadro anterior
+  uint16_t zone_us[PROFILE_ZONES];
+  uint16_t bus_us[PROFILE_BUSES];
+} profile_frame_t;
+
+#if PROFILER_ENABLED
+
+// Acumuladores crescentes; cada quadro registra a diferença desde o anterior,
+// então escritores em núcleos diferentes nunca precisam zerá-los
+extern volatile uint32_t profiler_zone_us[PROFILE_ZONES];
+extern volatile uint32_t profiler_bus_us[PROFILE_BUSES];
+
+typedef struct {
+  profile_zone_t zone;
+  uint32_t start;
+} profile_scope_t;
+
+static inline void profiler_scope_end(profile_scope_t *scope) {
+  profiler_zone_us[scope->zone] += time_us_32() - scope->start;
+}
+
+void profiler_bus_begin(profile_bus_t bus);
+void profiler_bus_end(profile_bus_t bus);
+void profiler_bus_add(profile_bus_t bus, uint32_t us);
+void profiler_frame_end(void);
+const profile_frame_t *profiler_last_frame(void);
+void profiler_telemetry_task(void);
+
+#define PROFILE_NAME2(line) profile_scope_##line
+#define PROFILE_NAME(line) PROFILE_NAME2(line)
+// Mede do ponto da macro até o fim do bloco que a contém
+#define PROFILE_SCOPE(zone) \
+  profile_scope_t PROFILE_NAME(__LINE__) __attribute__((cleanup(profiler_scope_end))) = {(zone), time_us_32()}
+#define PROFILE_BUS_BEGIN(bus) profiler_bus_begin(bus)
+#define PROFILE_BUS_END(bus) profiler_bus_end(bus)
+#define PROFILE_BUS_ADD(bus, us) profiler_bus_add((bus), (us))
+#define PROFILE_FRAME_END() profiler_frame_end()
+
+#else
+
+#define PROFILE_SCOPE(zone) ((void) 0)
+#define PROFILE_BUS_BEGIN(bus) ((void) 0)
+#define PROFILE_BUS_END(bus) ((void) 0)
+#define PROFILE_BUS_ADD(bus, us) ((void) 0)
+#define PROFILE_FRAME_END() ((void) 0)
+
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+#include "render_core.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+
+// Anel produtor único / consumidor único em SRAM compartilhada. O núcleo 0
+// escreve snapshots; o núcleo 1 sempre lê o mais recente e descarta os
+// anteriores. A FIFO entre os núcleos serve apenas de campainha.
+//
+// O produtor nunca espera nem recusa: cada snapshot vai para o slot
+// head, sobrescrevendo o mais antigo, lido ou não. O número de sequência de
+// cada slot funciona como um seqlock: o consumidor copia o slot head - 1 e
+// só aceita a cópia se a sequência era a esperada antes e depois dela; se o
+// produtor deu a volta no anel durante a cópia, tenta de novo com o novo
+// head. Assim o estado mais recente da simulação sempre chega ao núcleo 1.
+//
+// Para parar, o núcleo 0 marca stop_requested e toca a campainha. O núcleo
+// 1 só olha o pedido entre dois desenhos, quando não segura nenhuma trava;
+// espera os envios em curso (drain) e responde pela FIFO antes do reset.
+
+#define RENDER_QUEUE_MASK (RENDER_QUEUE_LEN - 1)
+#define RENDER_STOP_ACK 0x57095709  // Resposta do núcleo 1: ocioso, envios concluídos
+#define RENDER_SLOT_WRITING UINT32_MAX  // Sequência de um slot em escrita
+
+static game_snapshot_t queue[RENDER_QUEUE_LEN];
+static volatile uint32_t slot_sequence[RENDER_QUEUE_LEN];  // Sequência publicada em cada slot
+static volatile uint32_t head = 0;          // Escrito apenas pelo núcleo 0
+static volatile uint32_t tail = 0;          // Escrito apenas pelo núcleo 1
+static volatile uint32_t dropped = 0;       // Snapshots sobrescritos antes de o núcleo 1 chegar a eles
+static volatile uint32_t skipped = 0;       // Snapshots antigos ignorados pelo núcleo 1
+static game_snapshot_t current;             // Cópia em desenho no núcleo 1
+static volatile bool stop_requested = false;
+static render_fn_t render_fn;
+static render_drain_fn_t drain_fn;
+
+static void render_core_entry(void) {
+  while (true) {
+    multicore_fifo_pop_blocking();
+    while (multicore_fifo_rvalid())
+      multicore_fifo_pop_blocking();
+    if (stop_requested)
+      break;
+
+    uint32_t newest;
+    bool copied = false;
+    while ((newest = head) != tail) {
+      uint slot = (newest - 1) & RENDER_QUEUE_MASK;
+      if (slot_sequence[slot] != newest - 1)
+        continue;                   // O produtor já está sobrescrevendo este slot
+      __dmb();
+      current = queue[slot];
+      __dmb();
+      if (slot_sequence[slot] == newest - 1) {
+        copied = true;
+        break;
+      }
+    }
+    if (!copied)
+      continue;
+    skipped += newest - tail - 1;
+    tail = newest;
+    render_fn(&current);
+  }
+
+  if (drain_fn)
+    drain_fn();
+  multicore_fifo_push_blocking(RENDER_STOP_ACK);
+  while (true)
+    multicore_fifo_pop_blocking();
+}
+
+// Lança o núcleo 1, que passa a ser o dono dos displays. drain (opcional)
+// roda no núcleo 1 ao parar e deve esperar os envios em curso.
+void render_core_start(render_fn_t render, render_drain_fn_t drain) {
+  render_fn = render;
+  drain_fn = drain;
+  head = tail = 0;
+  for (uint i = 0; i < RENDER_QUEUE_LEN; ++i)
+    slot_sequence[i] = RENDER_SLOT_WRITING;
+  stop_requested = false;
+  multicore_launch_core1(render_core_entry);
+}
+
+// Para o núcleo 1 (ex.: antes de reiniciar), devolvendo os displays ao
+// núcleo 0. Bloqueia até o desenho em curso e os envios terminarem.
+void render_core_stop(void) {
+  stop_requested = true;
+  multicore_fifo_push_blocking(0);
+  while (multicore_fifo_pop_blocking() != RENDER_STOP_ACK)
+    tight_loop_contents();
+  multicore_reset_core1();
+}
+
+// Publica um snapshot sem bloquear, no lugar do mais antigo. Retorna false
+// se ele sobrescreveu um snapshot que o núcleo 1 ainda não tinha visto.
+bool render_core_publish(const game_snapshot_t *snapshot) {
+  uint32_t h = head;
+  uint slot = h & RENDER_QUEUE_MASK;
+  bool overwrote = h - tail >= RENDER_QUEUE_LEN;
+  if (overwrote)
+    dropped++;
+  slot_sequence[slot] = RENDER_SLOT_WRITING;
+  __dmb();
+  queue[slot] = *snapshot;
+  queue[slot].sequence = h;
+  __dmb();
+  slot_sequence[slot] = h;
+  head = h + 1;
+
+  // Campainha: se a FIFO estiver cheia o núcleo 1 já tem leitura pendente
+  if (multicore_fifo_wready())
+    multicore_fifo_push_blocking(h);
+  return !overwrote;
+}
+
+uint32_t render_core_dropped(void) {
+  return dropped;
+}
+
+uint32_t render_core_skipped(void) {
+  return skipped;
+}
@@ -0,0 +1,17 @@
+#ifndef RENDER_CORE_H
+#define RENDER_CORE_H
+
+#include "game_state.h"
+
+#define RENDER_QUEUE_LEN 4        // Slots do anel (potência de 2)
+
+typedef void (*render_fn_t)(const game_snapshot_t *snapshot);
+typedef void (*render_drain_fn_t)(void);
+
+void render_core_start(render_fn_t render, render_drain_fn_t drain);
+void render_core_stop(void);
+bool render_core_publish(const game_snapshot_t *snapshot);
+uint32_t render_core_dropped(void);
+uint32_t render_core_skipped(void);
+
+#endif
@@ -0,0 +1,172 @@
+#include "replay.h"
+#include <stdio.h>
+#include <string.h>
+
+// ---------------------------------------------------------------- gravação
+static bool recording = false;
+static uint32_t emitted = 0;          // Bytes já enviados em linhas "@rpl"
+static uint8_t line[REPLAY_LINE_BYTES];
+static uint line_len = 0;
+
+static uint16_t last_x, last_y;
+static uint8_t pending[REPLAY_MAX_BUTTONS];
+static uint pending_count = 0;
+static uint idle_run = 0;
+
+static void emit_line(void) {
+  if (line_len == 0)
+    return;
+  printf("@rpl %06lx ", (unsigned long) emitted);
+  for (uint i = 0; i < line_len; i++)
+    printf("%02x", line[i]);
+  printf("\n");
+  emitted += line_len;
+  line_len = 0;
+}
+
+static void put_byte(uint8_t byte) {
+  line[line_len++] = byte;
+  if (line_len == REPLAY_LINE_BYTES)
+    emit_line();
+}
+
+static void put_delta(int32_t delta) {
+  uint32_t zigzag = ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+  while (zigzag >= 0x80) {
+    put_byte(zigzag | 0x80);
+    zigzag >>= 7;
+  }
+  put_byte(zigzag);
+}
+
+static void flush_run(void) {
+  if (idle_run) {
+    put_byte(REPLAY_TAG_RUN | idle_run);
+    idle_run = 0;
+  }
+}
+
+static void put_record(uint8_t flags, int32_t dx, int32_t dy) {
+  flush_run();
+  put_byte(flags | pending_count);
+  for (uint i = 0; i < pending_count; i++)
+    put_byte(pending[i]);
+  pending_count = 0;
+  if (flags & REPLAY_TAG_X)
+    put_delta(dx);
+  if (flags & REPLAY_TAG_Y)
+    put_delta(dy);
+}
+
+// Começa um log novo; a semente é a que alimenta game_rand()
+void replay_record_start(uint32_t seed) {
+  recording = true;
+  emitted = 0;
+  line_len = 0;
+  pending_count = 0;
+  idle_run = 0;
+  last_x = last_y = REPLAY_AXIS_START;
+
+  for (uint i = 0; i < 4; i++)
+    put_byte(REPLAY_MAGIC[i]);
+  for (uint i = 0; i < 4; i++)
+    put_byte(seed >> (8 * i));
+}
+
+// Botão aceito pelo debounce; vai junto com o próximo passo
+void replay_record_button(replay_button_t button) {
+  if (!recording)
+    return;
+  if (pending_count == REPLAY_MAX_BUTTONS)
+    put_record(REPLAY_TAG_EVENTS_ONLY, 0, 0);
+  pending[pending_count++] = button;
+}
+
+// Um passo da simulação com as leituras filtradas que ele consumiu
+void replay_record_tick(uint16_t x, uint16_t y) {
+  if (!recording)
+    return;
+  if (pending_count == 0 && x == last_x && y == last_y) {
+    if (++idle_run == REPLAY_MAX_RUN)
+      flush_run();
+    return;
+  }
+  uint8_t flags = (x != last_x ? REPLAY_TAG_X : 0) | (y != last_y ? REPLAY_TAG_Y : 0);
+  put_record(flags, (int32_t) x - last_x, (int32_t) y - last_y);
+  last_x = x;
+  last_y = y;
+}
+
+// Envia tudo o que está pendente (fim de partida, saída do jogo)
+void replay_record_flush(void) {
+  if (!recording)
+    return;
+  if (pending_count)
+    put_record(REPLAY_TAG_EVENTS_ONLY, 0, 0);
+  flush_run();
+  emit_line();
+}
+
+uint32_t replay_record_size(void) {
+  return emitted + line_len;
+}
+
+// ---------------------------------------------------------------- reprodução
+bool replay_open(replay_reader_t *reader, const uint8_t *data, size_t len) {
+  if (len < REPLAY_HEADER_LEN || memcmp(data, REPLAY_MAGIC, 4) != 0)
+    return false;
+  reader->data = data;
+  reader->len = len;
+  reader->pos = REPLAY_HEADER_LEN;
+  reader->seed = data[4] | data[5] << 8 | data[6] << 16 | (uint32_t) data[7] << 24;
+  reader->x = reader->y = REPLAY_AXIS_START;
+  reader->run = 0;
+  return true;
+}
+
+static bool get_delta(replay_reader_t *reader, uint16_t *value) {
+  uint32_t zigzag = 0;
+  for (uint shift = 0; shift < 32; shift += 7) {
+    if (reader->pos >= reader->len)
+      return false;
+    uint8_t byte = reader->data[reader->pos++];
+    zigzag |= (uint32_t) (byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      *value += (int32_t) (zigzag >> 1) ^ -(int32_t) (zigzag & 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Próximo registro; false no fim do log ou se ele estiver truncado
+bool replay_next(replay_reader_t *reader, replay_entry_t *entry) {
+  entry->button_count = 0;
+  entry->step = true;
+  if (reader->run) {
+    reader->run--;
+  } else {
+    if (reader->pos >= reader->len)
+      return false;
+    uint8_t tag = reader->data[reader->pos++];
+    if (tag & REPLAY_TAG_RUN) {
+      if (tag == REPLAY_TAG_RUN)
+        return false;
+      reader->run = (tag & ~REPLAY_TAG_RUN) - 1;
+    } else {
+      entry->button_count = tag & REPLAY_TAG_BUTTONS;
+      if (reader->pos + entry->button_count > reader->len)
+        return false;
+      for (uint i = 0; i < entry->button_count; i++)
+        entry->buttons[i] = reader->data[reader->pos++];
+      if ((tag & REPLAY_TAG_X) && !get_delta(reader, &reader->x))
+        return false;
+      if ((tag & REPLAY_TAG_Y) && !get_delta(reader, &reader->y))
+        return false;
+      entry->step = !(tag & REPLAY_TAG_EVENTS_ONLY);
+    }
+  }
+  entry->x = reader->x;
+  entry->y = reader->y;
+  return true;
+}
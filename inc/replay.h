@@ -0,0 +1,62 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "pico/stdlib.h"
+
+// Log de entradas do jogo: semente + um registro por passo da simulação.
+//
+//   cabeçalho  'R' 'P' 'L' '1' | semente (u32 little-endian)
+//   1nnnnnnn   n passos seguidos sem botões e com o joystick parado
+//   000ebbxy   b botões (0..3, um byte cada) e, se x/y, o delta do eixo em
+//              varint zigzag; com e = 1 só há botões (sem passo)
+//
+// Na placa o log sai pela USB em linhas "@rpl <offset> <hex>", intercaladas
+// com o texto do printf (tools/replay_extract.py remonta o arquivo binário).
+
+#define REPLAY_MAGIC "RPL1"
+#define REPLAY_HEADER_LEN 8
+#define REPLAY_LINE_BYTES 32          // Bytes do log por linha "@rpl"
+#define REPLAY_MAX_BUTTONS 3
+#define REPLAY_MAX_RUN 127
+#define REPLAY_AXIS_START 2048        // Valor anterior do primeiro delta
+
+#define REPLAY_TAG_RUN 0x80
+#define REPLAY_TAG_EVENTS_ONLY 0x10
+#define REPLAY_TAG_Y 0x08
+#define REPLAY_TAG_X 0x04
+#define REPLAY_TAG_BUTTONS 0x03
+
+typedef enum {
+  REPLAY_BUTTON_A,
+  REPLAY_BUTTON_B,
+  REPLAY_BUTTON_JOYSTICK,
+} replay_button_t;
+
+// Um registro decodificado: botões aplicados antes do passo e, se step, as
+// leituras filtradas do joystick usadas no passo
+typedef struct {
+  uint8_t buttons[REPLAY_MAX_BUTTONS];
+  uint8_t button_count;
+  bool step;
+  uint16_t x, y;
+} replay_entry_t;
+
+typedef struct {
+  const uint8_t *data;
+  size_t len;
+  size_t pos;
+  uint32_t seed;
+  uint16_t x, y;
+  uint8_t run;                        // Passos ociosos ainda por entregar
+} replay_reader_t;
+
+void replay_record_start(uint32_t seed);
+void replay_record_button(replay_button_t button);
+void replay_record_tick(uint16_t x, uint16_t y);
+void replay_record_flush(void);
+uint32_t replay_record_size(void);
+
+bool replay_open(replay_reader_t *reader, const uint8_t *data, size_t len);
+bool replay_next(replay_reader_t *reader, replay_entry_t *entry);
+
+#endif
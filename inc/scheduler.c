@@ -0,0 +1,80 @@
+#include "scheduler.h"
+#include "hardware/sync.h"
+#include "profiler.h"
+
+static task_t tasks[SCHEDULER_MAX_TASKS];
+static uint task_count = 0;
+
+// Libera a tarefa e reagenda o alarme em relação ao instante em que ele
+// deveria ter disparado (retorno negativo), o que elimina a deriva. Os
+// atrasos só são contados aqui: se a liberação anterior ainda está
+// pendente, ela se funde com esta e conta como perdida.
+static int64_t scheduler_alarm_callback(alarm_id_t id, void *user_data) {
+  (void) id;
+  task_t *task = (task_t *) user_data;
+  if (task->pending)
+    task->overruns++;
+  task->pending = true;
+  __sev();
+  return -(int64_t) task->period_us;
+}
+
+// Registra uma tarefa periódica; a primeira liberação é imediata
+task_t *scheduler_add(const char *name, task_fn_t run, uint32_t period_us) {
+  if (task_count >= SCHEDULER_MAX_TASKS)
+    return NULL;
+  task_t *task = &tasks[task_count++];
+  task->name = name;
+  task->run = run;
+  task->period_us = period_us;
+  task->pending = true;
+  task->overruns = 0;
+  task->runs = 0;
+  task->max_runtime_us = 0;
+  task->alarm = add_alarm_in_us(period_us, scheduler_alarm_callback, task, true);
+  return task;
+}
+
+// Novo período passa a valer a partir da próxima liberação
+void scheduler_set_period(task_t *task, uint32_t period_us) {
+  task->period_us = period_us;
+}
+
+// Executa a tarefa liberada de maior prioridade. Retorna false se nenhuma
+// estava pronta.
+bool scheduler_poll(void) {
+  for (uint i = 0; i < task_count; ++i) {
+    task_t *task = &tasks[i];
+    if (!task->pending)
+      continue;
+    task->pending = false;
+
+    uint32_t start = time_us_32();
+    task->run();
+    uint32_t runtime = time_us_32() - start;
+
+    task->runs++;
+    if (runtime > task->max_runtime_us)
+      task->max_runtime_us = runtime;
+    return true;
+  }
+  return false;
+}
+
+// Laço principal: executa as tarefas liberadas e dorme até o próximo alarme
+void scheduler_run(void) {
+  while (true) {
+    if (!scheduler_poll()) {
+      PROFILE_SCOPE(PROFILE_IDLE);
+      __wfe();
+    }
+  }
+}
+
+uint scheduler_task_count(void) {
+  return task_count;
+}
+
+task_t *scheduler_task(uint index) {
+  return index < task_count ? &tasks[index] : NULL;
+}
@@ -0,0 +1,30 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "pico/stdlib.h"
+
+#define SCHEDULER_MAX_TASKS 8
+
+typedef void (*task_fn_t)(void);
+
+// Tarefa periódica: o alarme de hardware apenas a libera (pending); a
+// execução acontece no laço principal, em ordem de registro (prioridade)
+typedef struct {
+  const char *name;
+  task_fn_t run;
+  volatile uint32_t period_us;
+  volatile bool pending;
+  volatile uint32_t overruns;     // Liberações perdidas (escrito só pelo alarme)
+  uint32_t runs;
+  uint32_t max_runtime_us;
+  alarm_id_t alarm;
+} task_t;
+
+task_t *scheduler_add(const char *name, task_fn_t run, uint32_t period_us);
+void scheduler_set_period(task_t *task, uint32_t period_us);
+bool scheduler_poll(void);
+void scheduler_run(void);
+uint scheduler_task_count(void);
+task_t *scheduler_task(uint index);
+
+#endif
@@ -0,0 +1,352 @@
+// Gerado por tools/gen_sfx.py -- não editar manualmente
+// PCM de 8 bits sem sinal, 8000 Hz
+#include "pcm.h"
+
+static const uint8_t sfx_explosion_data[2800] = {
+  0x8b, 0x92, 0x6d, 0x5c, 0x66, 0x74, 0x49, 0x3d, 0x1e, 0x2b, 0x50, 0x4d, 0x39, 0x5f, 0x72, 0xa3,
+  0xbf, 0xc3, 0xda, 0xd8, 0xde, 0xb2, 0x92, 0x76, 0xa9, 0x87, 0x98, 0xbd, 0x9d, 0x64, 0x81, 0x9f,
+  0x69, 0x8e, 0x85, 0x5a, 0x62, 0x6d, 0x5c, 0x92, 0xa4, 0x86, 0xa0, 0x72, 0x70, 0x69, 0x8b, 0x94,
+  0x71, 0x49, 0x3b, 0x72, 0x78, 0x9e, 0x70, 0x5a, 0x87, 0xa8, 0x9b, 0x88, 0x99, 0xac, 0x8c, 0x6c,
+  0x84, 0xab, 0xc7, 0x9e, 0x6a, 0x9a, 0xc2, 0xce, 0xd4, 0xc0, 0xb9, 0xd7, 0xe8, 0xeb, 0xda, 0xb7,
+  0x86, 0xa1, 0x95, 0x6f, 0x5e, 0x7f, 0x5a, 0x7d, 0x6f, 0x5e, 0x44, 0x3f, 0x50, 0x47, 0x2d, 0x3f,
+  0x7c, 0x66, 0x8b, 0xad, 0xa2, 0x79, 0x6c, 0x8c, 0xb4, 0x7f, 0x55, 0x3e, 0x3e, 0x41, 0x61, 0x78,
+  0x91, 0x81, 0xad, 0xa0, 0xb8, 0x84, 0x70, 0x7e, 0x78, 0x51, 0x42, 0x39, 0x49, 0x38, 0x27, 0x2c,
+  0x51, 0x46, 0x64, 0x91, 0x76, 0x52, 0x3a, 0x3b, 0x5a, 0x3a, 0x33, 0x4a, 0x49, 0x80, 0x79, 0x6d,
+  0x7e, 0x68, 0x63, 0x7c, 0x5f, 0x69, 0x61, 0x80, 0x92, 0xa8, 0x95, 0x9b, 0x83, 0x93, 0x6f, 0x82,
+  0x5d, 0x60, 0x47, 0x34, 0x4d, 0x40, 0x6d, 0x4b, 0x5f, 0x6f, 0x74, 0x53, 0x6d, 0x59, 0x86, 0x89,
+  0x9f, 0xc0, 0xa6, 0xa0, 0xb8, 0xa6, 0xaa, 0xab, 0x83, 0x74, 0x89, 0x9e, 0xa0, 0xa9, 0xa9, 0xc2,
+  0xd2, 0xbc, 0x86, 0x5d, 0x79, 0x8a, 0xa4, 0x76, 0x9f, 0x74, 0x75, 0x71, 0x99, 0x79, 0x54, 0x79,
+  0x89, 0x78, 0x55, 0x5d, 0x83, 0x96, 0x88, 0xa9, 0x8a, 0x80, 0x74, 0x8c, 0x67, 0x79, 0x8e, 0x9f,
+  0x8e, 0x6b, 0x73, 0x58, 0x3c, 0x38, 0x29, 0x4f, 0x61, 0x81, 0xa1, 0x79, 0x92, 0x99, 0x7c, 0x58,
+  0x4f, 0x82, 0x85, 0xa1, 0xb0, 0xc5, 0xa9, 0xb0, 0xc6, 0xda, 0xd0, 0xbf, 0x9c, 0x98, 0x8b, 0x6f,
+  0x5e, 0x4a, 0x7b, 0x8b, 0x90, 0x71, 0x61, 0x7e, 0x82, 0x72, 0x8e, 0x8a, 0x9c, 0xb5, 0xbe, 0xa1,
+  0xb9, 0xc9, 0xac, 0xc5, 0xab, 0x83, 0x67, 0x67, 0x79, 0x5b, 0x56, 0x80, 0x90, 0x67, 0x59, 0x67,
+  0x71, 0x71, 0x91, 0xaa, 0xab, 0x93, 0xa1, 0x8e, 0x8b, 0x6b, 0x6d, 0x89, 0x82, 0xa1, 0xaa, 0x90,
+  0x95, 0xb2, 0x8b, 0xa0, 0x88, 0xa8, 0xc1, 0xc5, 0xa1, 0xae, 0x86, 0x87, 0x63, 0x59, 0x64, 0x74,
+  0x9a, 0x78, 0x59, 0x70, 0x6b, 0x5f, 0x7a, 0x93, 0x97, 0xa9, 0x8e, 0x72, 0x68, 0x59, 0x72, 0x8a,
+  0x93, 0x80, 0x91, 0x80, 0x68, 0x82, 0xa0, 0xb3, 0x88, 0x7c, 0x63, 0x83, 0x8c, 0x6f, 0x6a, 0x6b,
+  0x7b, 0x67, 0x69, 0x89, 0x9e, 0x75, 0x5f, 0x89, 0x83, 0x77, 0x93, 0x86, 0x9d, 0xab, 0x8a, 0x6b,
+  0x8a, 0x67, 0x5f, 0x53, 0x63, 0x68, 0x7a, 0x68, 0x8c, 0x6a, 0x78, 0x6a, 0x53, 0x7d, 0x7f, 0x79,
+  0x5f, 0x82, 0x73, 0x60, 0x51, 0x4f, 0x57, 0x80, 0x61, 0x61, 0x56, 0x52, 0x61, 0x68, 0x5c, 0x73,
+  0x7c, 0x74, 0x5d, 0x49, 0x3d, 0x4c, 0x64, 0x6b, 0x5c, 0x55, 0x48, 0x6d, 0x80, 0x96, 0x8f, 0x7b,
+  0x71, 0x77, 0x98, 0x73, 0x6f, 0x69, 0x8d, 0x76, 0x92, 0xa8, 0x97, 0x8b, 0x9d, 0x97, 0x9f, 0x9e,
+  0x99, 0x9e, 0xa2, 0x8e, 0x7f, 0x96, 0x76, 0x92, 0x8e, 0x89, 0x7d, 0x8a, 0x6a, 0x64, 0x69, 0x55,
+  0x75, 0x76, 0x67, 0x80, 0x81, 0x66, 0x7b, 0x7b, 0x61, 0x4c, 0x64, 0x5b, 0x4a, 0x69, 0x5f, 0x4b,
+  0x74, 0x72, 0x88, 0x78, 0x86, 0x7a, 0x89, 0xa0, 0x84, 0x76, 0x66, 0x75, 0x6e, 0x77, 0x73, 0x6c,
+  0x79, 0x69, 0x81, 0x8e, 0x90, 0xa2, 0x9a, 0xaf, 0xbd, 0xbe, 0xb9, 0x8f, 0x93, 0x9e, 0x7d, 0x84,
+  0x86, 0x6c, 0x6e, 0x90, 0x9b, 0x7c, 0x6f, 0x69, 0x82, 0x79, 0x8e, 0x84, 0x68, 0x67, 0x85, 0x94,
+  0x7a, 0x6e, 0x87, 0x99, 0x95, 0xa5, 0xa6, 0x89, 0x86, 0x81, 0x6b, 0x88, 0x99, 0x97, 0x7f, 0x73,
+  0x75, 0x6d, 0x83, 0x81, 0x98, 0x78, 0x93, 0x84, 0x8c, 0x88, 0x8d, 0x89, 0x81, 0x6d, 0x6c, 0x74,
+  0x67, 0x67, 0x76, 0x94, 0x85, 0x8d, 0x89, 0x9a, 0x7e, 0x73, 0x91, 0xa1, 0xb4, 0xba, 0xa3, 0x91,
+  0x87, 0x95, 0x83, 0x85, 0x89, 0x8a, 0x9c, 0x8d, 0x80, 0x80, 0x6f, 0x69, 0x7b, 0x8d, 0xa1, 0x83,
+  0x77, 0x6d, 0x7f, 0x96, 0xa1, 0x9a, 0xa2, 0x8d, 0x91, 0x9b, 0x94, 0x9a, 0x8c, 0x9c, 0x7c, 0x77,
+  0x74, 0x6f, 0x72, 0x86, 0x74, 0x84, 0x90, 0x83, 0x96, 0x89, 0x7d, 0x6a, 0x64, 0x81, 0x78, 0x6c,
+  0x61, 0x77, 0x8c, 0x7b, 0x90, 0x80, 0x6e, 0x88, 0x82, 0x7a, 0x64, 0x56, 0x51, 0x5b, 0x5b, 0x63,
+  0x54, 0x72, 0x6b, 0x7f, 0x67, 0x60, 0x51, 0x58, 0x77, 0x67, 0x54, 0x77, 0x6d, 0x7c, 0x68, 0x5b,
+  0x56, 0x74, 0x8c, 0x7f, 0x79, 0x73, 0x8d, 0x90, 0x81, 0x89, 0x7b, 0x7b, 0x86, 0x72, 0x65, 0x7d,
+  0x7b, 0x77, 0x84, 0x93, 0x8b, 0x7a, 0x91, 0x7c, 0x7b, 0x92, 0x8f, 0x9b, 0xa5, 0xab, 0x9e, 0x8b,
+  0x77, 0x7f, 0x6f, 0x6e, 0x60, 0x73, 0x6b, 0x78, 0x78, 0x73, 0x60, 0x5d, 0x4f, 0x6d, 0x60, 0x5c,
+  0x4f, 0x71, 0x64, 0x57, 0x6c, 0x70, 0x6f, 0x6f, 0x5e, 0x51, 0x57, 0x5d, 0x5a, 0x6b, 0x6c, 0x6f,
+  0x67, 0x5c, 0x78, 0x7f, 0x8f, 0x78, 0x88, 0x87, 0x8f, 0x80, 0x7c, 0x83, 0x79, 0x74, 0x79, 0x81,
+  0x91, 0x98, 0xa8, 0xa1, 0x89, 0x88, 0x9b, 0x90, 0x91, 0x98, 0x83, 0x7c, 0x7f, 0x70, 0x7a, 0x8f,
+  0x7c, 0x83, 0x91, 0x9e, 0x8f, 0x90, 0x79, 0x6a, 0x65, 0x5f, 0x70, 0x77, 0x82, 0x8e, 0x89, 0x82,
+  0x79, 0x69, 0x84, 0x75, 0x8a, 0x7f, 0x6b, 0x7b, 0x80, 0x80, 0x91, 0x7c, 0x8b, 0x97, 0x91, 0x80,
+  0x73, 0x73, 0x81, 0x6e, 0x68, 0x5d, 0x5c, 0x6e, 0x7e, 0x71, 0x71, 0x60, 0x5d, 0x52, 0x63, 0x5e,
+  0x60, 0x60, 0x58, 0x67, 0x63, 0x67, 0x73, 0x6e, 0x85, 0x91, 0x90, 0x9f, 0x8b, 0x95, 0x81, 0x72,
+  0x87, 0x99, 0x9a, 0x9d, 0x8f, 0x9e, 0x8f, 0x9a, 0x8e, 0x82, 0x77, 0x7f, 0x6b, 0x70, 0x75, 0x69,
+  0x69, 0x7d, 0x7e, 0x7c, 0x75, 0x67, 0x71, 0x6e, 0x5f, 0x5f, 0x6c, 0x60, 0x6f, 0x7f, 0x7b, 0x8f,
+  0x8a, 0x92, 0x9f, 0x92, 0x82, 0x74, 0x85, 0x85, 0x8a, 0x8d, 0x7d, 0x6b, 0x84, 0x76, 0x72, 0x78,
+  0x6d, 0x6c, 0x72, 0x64, 0x60, 0x56, 0x5c, 0x64, 0x71, 0x7b, 0x7e, 0x7b, 0x73, 0x68, 0x7a, 0x71,
+  0x73, 0x73, 0x88, 0x7e, 0x7f, 0x78, 0x71, 0x84, 0x8f, 0x8b, 0x84, 0x86, 0x7a, 0x82, 0x94, 0x84,
+  0x76, 0x73, 0x83, 0x88, 0x77, 0x82, 0x77, 0x7d, 0x73, 0x7d, 0x72, 0x81, 0x90, 0x93, 0x94, 0x9c,
+  0xa5, 0x9e, 0x97, 0x99, 0x9d, 0x99, 0x95, 0x97, 0x89, 0x7d, 0x74, 0x79, 0x7e, 0x75, 0x69, 0x62,
+  0x5a, 0x6b, 0x64, 0x68, 0x5c, 0x56, 0x50, 0x4c, 0x57, 0x59, 0x62, 0x79, 0x7e, 0x6c, 0x80, 0x70,
+  0x71, 0x66, 0x6c, 0x74, 0x7c, 0x85, 0x88, 0x91, 0x80, 0x77, 0x74, 0x66, 0x5e, 0x6b, 0x5f, 0x73,
+  0x6b, 0x65, 0x70, 0x69, 0x7f, 0x87, 0x85, 0x83, 0x86, 0x82, 0x87, 0x7f, 0x73, 0x6a, 0x6a, 0x6d,
+  0x80, 0x8c, 0x78, 0x83, 0x85, 0x78, 0x88, 0x88, 0x92, 0x80, 0x81, 0x91, 0x8e, 0x82, 0x8d, 0x9a,
+  0x8b, 0x90, 0x89, 0x90, 0x7c, 0x85, 0x94, 0x99, 0x91, 0x83, 0x77, 0x73, 0x77, 0x83, 0x7c, 0x8c,
+  0x96, 0x99, 0x93, 0x9e, 0x88, 0x90, 0x92, 0x90, 0x89, 0x84, 0x8f, 0x7f, 0x8b, 0x7a, 0x76, 0x7f,
+  0x7e, 0x7b, 0x6c, 0x7b, 0x71, 0x83, 0x85, 0x7e, 0x72, 0x80, 0x85, 0x77, 0x7b, 0x74, 0x68, 0x79,
+  0x73, 0x86, 0x84, 0x8b, 0x8c, 0x7f, 0x8b, 0x94, 0x86, 0x92, 0x8f, 0x80, 0x8b, 0x8e, 0x7b, 0x7c,
+  0x7b, 0x75, 0x6d, 0x79, 0x74, 0x7b, 0x70, 0x7c, 0x78, 0x79, 0x8a, 0x90, 0x7e, 0x7a, 0x75, 0x80,
+  0x80, 0x84, 0x8c, 0x88, 0x89, 0x88, 0x7b, 0x85, 0x79, 0x79, 0x6e, 0x72, 0x71, 0x6c, 0x65, 0x60,
+  0x64, 0x6e, 0x78, 0x85, 0x7f, 0x89, 0x7a, 0x6f, 0x6a, 0x72, 0x6e, 0x69, 0x77, 0x7d, 0x85, 0x88,
+  0x83, 0x91, 0x8b, 0x84, 0x82, 0x82, 0x8e, 0x98, 0x95, 0x9a, 0x8b, 0x88, 0x79, 0x7b, 0x7e, 0x83,
+  0x8e, 0x8e, 0x94, 0x8a, 0x7e, 0x71, 0x7b, 0x82, 0x7b, 0x7f, 0x87, 0x7a, 0x7b, 0x6f, 0x79, 0x84,
+  0x7e, 0x7c, 0x82, 0x81, 0x83, 0x82, 0x7c, 0x7a, 0x7a, 0x72, 0x7e, 0x78, 0x81, 0x8b, 0x7b, 0x82,
+  0x74, 0x80, 0x89, 0x7d, 0x83, 0x7e, 0x73, 0x6e, 0x78, 0x6e, 0x66, 0x60, 0x74, 0x73, 0x6b, 0x7d,
+  0x73, 0x72, 0x81, 0x88, 0x7f, 0x7d, 0x73, 0x77, 0x84, 0x83, 0x75, 0x81, 0x77, 0x72, 0x80, 0x8e,
+  0x86, 0x89, 0x81, 0x77, 0x7f, 0x7f, 0x88, 0x8b, 0x95, 0x92, 0x97, 0x92, 0x94, 0x96, 0x98, 0x85,
+  0x77, 0x74, 0x80, 0x8d, 0x93, 0x95, 0x9a, 0x87, 0x8d, 0x7c, 0x75, 0x6c, 0x7c, 0x75, 0x72, 0x7b,
+  0x86, 0x8a, 0x7b, 0x6f, 0x80, 0x89, 0x81, 0x81, 0x76, 0x85, 0x7a, 0x82, 0x85, 0x7a, 0x71, 0x73,
+  0x7d, 0x89, 0x85, 0x88, 0x88, 0x8a, 0x92, 0x99, 0x8f, 0x7e, 0x8a, 0x8a, 0x8c, 0x92, 0x99, 0x91,
+  0x80, 0x86, 0x90, 0x86, 0x7f, 0x7a, 0x80, 0x7e, 0x80, 0x74, 0x6c, 0x79, 0x74, 0x80, 0x7c, 0x83,
+  0x86, 0x91, 0x91, 0x89, 0x8b, 0x91, 0x84, 0x88, 0x80, 0x89, 0x93, 0x83, 0x76, 0x84, 0x84, 0x8e,
+  0x92, 0x8a, 0x86, 0x7e, 0x7b, 0x79, 0x81, 0x80, 0x7b, 0x7f, 0x75, 0x7e, 0x74, 0x83, 0x7f, 0x74,
+  0x72, 0x70, 0x80, 0x7b, 0x7a, 0x7e, 0x7a, 0x87, 0x8b, 0x7d, 0x7c, 0x81, 0x83, 0x8b, 0x81, 0x80,
+  0x83, 0x84, 0x8a, 0x81, 0x89, 0x7e, 0x76, 0x6f, 0x78, 0x82, 0x88, 0x80, 0x87, 0x7d, 0x84, 0x88,
+  0x8e, 0x90, 0x95, 0x92, 0x98, 0x99, 0x9b, 0x9e, 0x93, 0x86, 0x82, 0x89, 0x8f, 0x8a, 0x93, 0x8f,
+  0x89, 0x82, 0x87, 0x7e, 0x7f, 0x79, 0x73, 0x6b, 0x75, 0x7e, 0x89, 0x7d, 0x86, 0x87, 0x8e, 0x8a,
+  0x92, 0x8a, 0x80, 0x7b, 0x7b, 0x87, 0x8d, 0x93, 0x8b, 0x8e, 0x89, 0x85, 0x83, 0x7c, 0x7e, 0x76,
+  0x77, 0x7c, 0x75, 0x6f, 0x7c, 0x73, 0x7b, 0x79, 0x7d, 0x80, 0x86, 0x86, 0x8c, 0x80, 0x87, 0x83,
+  0x87, 0x7e, 0x85, 0x7c, 0x88, 0x80, 0x79, 0x80, 0x7a, 0x80, 0x78, 0x7a, 0x81, 0x7d, 0x7a, 0x77,
+  0x7b, 0x80, 0x77, 0x7d, 0x81, 0x80, 0x81, 0x81, 0x7b, 0x80, 0x7f, 0x78, 0x73, 0x6d, 0x6e, 0x79,
+  0x7e, 0x7f, 0x89, 0x8e, 0x8f, 0x84, 0x83, 0x82, 0x78, 0x80, 0x7f, 0x84, 0x7e, 0x7e, 0x7d, 0x83,
+  0x7b, 0x80, 0x89, 0x85, 0x82, 0x88, 0x7f, 0x7b, 0x85, 0x81, 0x80, 0x76, 0x74, 0x77, 0x80, 0x81,
+  0x88, 0x88, 0x7f, 0x88, 0x88, 0x7e, 0x88, 0x8a, 0x83, 0x8c, 0x88, 0x8b, 0x86, 0x8d, 0x8e, 0x88,
+  0x8d, 0x94, 0x88, 0x8f, 0x8c, 0x87, 0x87, 0x8d, 0x87, 0x7e, 0x80, 0x79, 0x7c, 0x86, 0x87, 0x89,
+  0x8b, 0x8f, 0x94, 0x93, 0x93, 0x97, 0x95, 0x88, 0x7d, 0x79, 0x7a, 0x85, 0x84, 0x84, 0x89, 0x85,
+  0x7a, 0x73, 0x78, 0x77, 0x7e, 0x81, 0x88, 0x8a, 0x8d, 0x8b, 0x8c, 0x86, 0x83, 0x86, 0x87, 0x88,
+  0x83, 0x86, 0x7f, 0x7d, 0x76, 0x71, 0x73, 0x7d, 0x81, 0x87, 0x7c, 0x81, 0x78, 0x81, 0x89, 0x86,
+  0x80, 0x7e, 0x77, 0x80, 0x7d, 0x87, 0x84, 0x84, 0x8b, 0x86, 0x8d, 0x88, 0x81, 0x80, 0x7f, 0x79,
+  0x73, 0x7a, 0x74, 0x6f, 0x76, 0x7a, 0x7d, 0x7c, 0x77, 0x80, 0x87, 0x7d, 0x7a, 0x84, 0x7c, 0x7e,
+  0x83, 0x84, 0x8b, 0x87, 0x8c, 0x83, 0x86, 0x87, 0x8d, 0x86, 0x89, 0x8c, 0x86, 0x86, 0x83, 0x81,
+  0x87, 0x87, 0x8b, 0x88, 0x83, 0x7c, 0x79, 0x7e, 0x85, 0x88, 0x7e, 0x87, 0x85, 0x84, 0x7b, 0x83,
+  0x7d, 0x7d, 0x7e, 0x84, 0x86, 0x88, 0x89, 0x86, 0x84, 0x7d, 0x81, 0x78, 0x80, 0x7a, 0x80, 0x86,
+  0x7c, 0x77, 0x81, 0x81, 0x79, 0x82, 0x81, 0x86, 0x88, 0x8a, 0x8c, 0x85, 0x8c, 0x8d, 0x85, 0x7f,
+  0x81, 0x84, 0x82, 0x84, 0x80, 0x81, 0x7a, 0x81, 0x81, 0x79, 0x7b, 0x77, 0x74, 0x79, 0x75, 0x74,
+  0x76, 0x72, 0x72, 0x78, 0x7c, 0x82, 0x86, 0x81, 0x79, 0x7b, 0x79, 0x7d, 0x76, 0x79, 0x80, 0x7d,
+  0x81, 0x7c, 0x7e, 0x7f, 0x86, 0x83, 0x81, 0x88, 0x8a, 0x8d, 0x87, 0x85, 0x83, 0x7d, 0x78, 0x80,
+  0x7e, 0x7f, 0x81, 0x7e, 0x85, 0x81, 0x81, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x83, 0x80, 0x82, 0x85,
+  0x82, 0x7b, 0x74, 0x7a, 0x82, 0x81, 0x87, 0x83, 0x7e, 0x83, 0x80, 0x83, 0x8a, 0x88, 0x7f, 0x78,
+  0x7e, 0x7d, 0x79, 0x80, 0x84, 0x80, 0x83, 0x7d, 0x7f, 0x80, 0x87, 0x85, 0x81, 0x7c, 0x7b, 0x75,
+  0x73, 0x74, 0x7e, 0x7c, 0x7f, 0x80, 0x7e, 0x86, 0x81, 0x7c, 0x84, 0x87, 0x8a, 0x81, 0x84, 0x87,
+  0x87, 0x8b, 0x88, 0x82, 0x88, 0x85, 0x7f, 0x7c, 0x82, 0x7f, 0x78, 0x79, 0x82, 0x84, 0x80, 0x7c,
+  0x78, 0x75, 0x71, 0x75, 0x74, 0x72, 0x75, 0x7f, 0x79, 0x77, 0x80, 0x7b, 0x77, 0x7d, 0x83, 0x7d,
+  0x82, 0x7e, 0x78, 0x7a, 0x76, 0x7f, 0x7c, 0x7c, 0x7e, 0x82, 0x86, 0x84, 0x87, 0x81, 0x7f, 0x82,
+  0x84, 0x88, 0x8b, 0x82, 0x7b, 0x78, 0x7a, 0x82, 0x7b, 0x7a, 0x78, 0x79, 0x81, 0x7b, 0x75, 0x7a,
+  0x7c, 0x7f, 0x82, 0x80, 0x7b, 0x7e, 0x7d, 0x7f, 0x7e, 0x83, 0x87, 0x86, 0x88, 0x85, 0x84, 0x7e,
+  0x82, 0x84, 0x82, 0x85, 0x80, 0x7c, 0x7f, 0x83, 0x88, 0x82, 0x86, 0x89, 0x86, 0x7f, 0x7a, 0x79,
+  0x79, 0x7d, 0x7e, 0x7f, 0x7f, 0x85, 0x81, 0x80, 0x82, 0x82, 0x88, 0x83, 0x7d, 0x82, 0x7d, 0x7e,
+  0x81, 0x7e, 0x83, 0x7d, 0x83, 0x82, 0x83, 0x86, 0x82, 0x7e, 0x7b, 0x7b, 0x7e, 0x80, 0x7b, 0x78,
+  0x79, 0x7f, 0x82, 0x81, 0x7b, 0x7f, 0x82, 0x88, 0x88, 0x82, 0x7b, 0x7b, 0x7e, 0x7d, 0x7d, 0x7c,
+  0x7c, 0x78, 0x7b, 0x7c, 0x79, 0x7f, 0x84, 0x83, 0x87, 0x82, 0x85, 0x82, 0x80, 0x86, 0x84, 0x88,
+  0x85, 0x84, 0x88, 0x85, 0x81, 0x84, 0x89, 0x86, 0x87, 0x8a, 0x83, 0x7e, 0x7e, 0x82, 0x7f, 0x7d,
+  0x7a, 0x80, 0x7b, 0x78, 0x78, 0x7b, 0x7e, 0x83, 0x7e, 0x78, 0x7a, 0x7a, 0x7f, 0x7a, 0x7b, 0x7b,
+  0x79, 0x7e, 0x80, 0x82, 0x85, 0x7f, 0x7b, 0x7b, 0x7a, 0x76, 0x7d, 0x82, 0x81, 0x7d, 0x7c, 0x7c,
+  0x81, 0x7e, 0x7d, 0x7a, 0x79, 0x7d, 0x83, 0x80, 0x81, 0x80, 0x7c, 0x79, 0x7e, 0x7c, 0x79, 0x7f,
+  0x80, 0x7b, 0x82, 0x7d, 0x7a, 0x7c, 0x78, 0x7e, 0x7d, 0x79, 0x7d, 0x7f, 0x81, 0x7f, 0x84, 0x80,
+  0x81, 0x7c, 0x7c, 0x7e, 0x79, 0x7f, 0x7e, 0x7b, 0x7f, 0x80, 0x7c, 0x78, 0x78, 0x7d, 0x7c, 0x81,
+  0x7f, 0x7f, 0x84, 0x85, 0x7e, 0x7e, 0x7b, 0x77, 0x7a, 0x7c, 0x7d, 0x7b, 0x81, 0x83, 0x7f, 0x7d,
+  0x7c, 0x7b, 0x7a, 0x77, 0x7c, 0x79, 0x79, 0x7c, 0x7b, 0x7a, 0x7e, 0x82, 0x7d, 0x7b, 0x7a, 0x7b,
+  0x77, 0x7e, 0x83, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x82, 0x7e, 0x81, 0x7d, 0x7b, 0x80, 0x85,
+  0x89, 0x82, 0x83, 0x7f, 0x7e, 0x7b, 0x80, 0x7b, 0x7b, 0x77, 0x7c, 0x7a, 0x78, 0x75, 0x74, 0x7a,
+  0x7b, 0x7c, 0x7f, 0x81, 0x83, 0x7e, 0x81, 0x83, 0x81, 0x7f, 0x7c, 0x7e, 0x7a, 0x7c, 0x7c, 0x7d,
+  0x7d, 0x7c, 0x79, 0x7c, 0x7f, 0x80, 0x83, 0x87, 0x86, 0x88, 0x8a, 0x89, 0x83, 0x87, 0x88, 0x86,
+  0x83, 0x80, 0x83, 0x7e, 0x7e, 0x7f, 0x82, 0x83, 0x81, 0x7d, 0x82, 0x7f, 0x7f, 0x81, 0x7e, 0x81,
+  0x84, 0x81, 0x83, 0x81, 0x83, 0x7f, 0x81, 0x80, 0x7c, 0x7b, 0x7c, 0x7f, 0x84, 0x82, 0x85, 0x86,
+  0x81, 0x82, 0x80, 0x7f, 0x7f, 0x82, 0x81, 0x84, 0x87, 0x85, 0x80, 0x7d, 0x7b, 0x7d, 0x79, 0x7f,
+  0x80, 0x80, 0x7f, 0x82, 0x82, 0x80, 0x83, 0x85, 0x84, 0x84, 0x84, 0x82, 0x80, 0x81, 0x82, 0x82,
+  0x82, 0x85, 0x85, 0x86, 0x88, 0x85, 0x84, 0x84, 0x80, 0x7e, 0x7f, 0x7e, 0x82, 0x82, 0x82, 0x81,
+  0x85, 0x80, 0x81, 0x84, 0x85, 0x83, 0x7f, 0x81, 0x7d, 0x7e, 0x81, 0x7e, 0x83, 0x7e, 0x7c, 0x7f,
+  0x7c, 0x7d, 0x82, 0x7e, 0x7d, 0x82, 0x7f, 0x7b, 0x79, 0x7d, 0x7f, 0x81, 0x81, 0x7f, 0x7e, 0x7c,
+  0x7d, 0x7e, 0x82, 0x81, 0x7e, 0x7b, 0x7a, 0x79, 0x77, 0x7a, 0x80, 0x7f, 0x80, 0x7c, 0x7b, 0x7b,
+  0x7a, 0x77, 0x77, 0x75, 0x7b, 0x7a, 0x7e, 0x7b, 0x7e, 0x82, 0x81, 0x81, 0x7f, 0x82, 0x80, 0x7e,
+  0x7b, 0x7e, 0x7b, 0x79, 0x7c, 0x7e, 0x7f, 0x82, 0x83, 0x83, 0x86, 0x84, 0x85, 0x84, 0x81, 0x81,
+  0x82, 0x7e, 0x7c, 0x7b, 0x80, 0x7e, 0x7f, 0x81, 0x7e, 0x7c, 0x7f, 0x83, 0x81, 0x84, 0x82, 0x7e,
+  0x7d, 0x7a, 0x79, 0x7a, 0x78, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a, 0x7f, 0x7f, 0x7d, 0x80, 0x7f, 0x7b,
+  0x7e, 0x7d, 0x81, 0x7f, 0x80, 0x83, 0x83, 0x80, 0x7e, 0x82, 0x7e, 0x82, 0x85, 0x83, 0x7f, 0x80,
+  0x7d, 0x7d, 0x7c, 0x7f, 0x7b, 0x7d, 0x7d, 0x7b, 0x7e, 0x80, 0x7f, 0x7d, 0x7e, 0x82, 0x81, 0x7d,
+  0x81, 0x81, 0x84, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x84, 0x83, 0x85, 0x85, 0x85, 0x81,
+  0x82, 0x84, 0x86, 0x83, 0x80, 0x81, 0x7e, 0x7e, 0x80, 0x82, 0x84, 0x84, 0x81, 0x81, 0x7f, 0x81,
+  0x80, 0x83, 0x82, 0x82, 0x7e, 0x7d, 0x7f, 0x80, 0x83, 0x84, 0x86, 0x82, 0x82, 0x82, 0x85, 0x81,
+  0x7f, 0x82, 0x84, 0x80, 0x7f, 0x82, 0x85, 0x85, 0x86, 0x85, 0x83, 0x81, 0x83, 0x85, 0x87, 0x88,
+  0x8a, 0x85, 0x85, 0x86, 0x81, 0x80, 0x80, 0x82, 0x82, 0x85, 0x86, 0x87, 0x86, 0x86, 0x87, 0x84,
+  0x81, 0x83, 0x84, 0x81, 0x7e, 0x7e, 0x81, 0x84, 0x83, 0x83, 0x83, 0x84, 0x86, 0x86, 0x86, 0x86,
+  0x85, 0x84, 0x81, 0x7e, 0x7e, 0x81, 0x82, 0x7e, 0x7d, 0x7b, 0x7c, 0x7d, 0x7d, 0x7a, 0x7d, 0x7c,
+  0x80, 0x7d, 0x81, 0x7e, 0x82, 0x7f, 0x80, 0x82, 0x83, 0x83, 0x81, 0x7f, 0x82, 0x82, 0x80, 0x7f,
+  0x81, 0x7f, 0x80, 0x7d, 0x7c, 0x7b, 0x7d, 0x7d, 0x7a, 0x7f, 0x7f, 0x82, 0x81, 0x7f, 0x81, 0x7f,
+  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7d, 0x7d, 0x7b, 0x7e,
+  0x80, 0x80, 0x83, 0x7f, 0x80, 0x82, 0x84, 0x81, 0x80, 0x81, 0x7e, 0x7e, 0x7c, 0x80, 0x80, 0x7f,
+  0x7f, 0x7f, 0x7d, 0x7c, 0x7c, 0x7b, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7f, 0x7e, 0x82,
+  0x82, 0x84, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x83, 0x85, 0x85, 0x86, 0x86,
+  0x82, 0x82, 0x82, 0x83, 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
+  0x80, 0x80, 0x82, 0x83, 0x84, 0x85, 0x84, 0x82, 0x82, 0x84, 0x83, 0x81, 0x7e, 0x7d, 0x7b, 0x7a,
+  0x7c, 0x7d, 0x7f, 0x81, 0x7e, 0x80, 0x82, 0x83, 0x80, 0x82, 0x7f, 0x80, 0x7d, 0x7c, 0x7a, 0x7d,
+  0x7e, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x83, 0x84, 0x81, 0x81, 0x82, 0x80, 0x7e, 0x7c, 0x7c,
+  0x7d, 0x7d, 0x7f, 0x7e, 0x80, 0x82, 0x81, 0x82, 0x7f, 0x7e, 0x7f, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c,
+  0x7f, 0x80, 0x81, 0x7f, 0x7d, 0x7e, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x81, 0x81, 0x82,
+  0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7d, 0x7c, 0x80, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7c,
+  0x7f, 0x80, 0x80, 0x7e, 0x80, 0x7d, 0x80, 0x7e, 0x7d, 0x7b, 0x7b, 0x7a, 0x7c, 0x7a, 0x7e, 0x81,
+  0x82, 0x84, 0x84, 0x85, 0x85, 0x83, 0x85, 0x84, 0x83, 0x81, 0x83, 0x84, 0x85, 0x81, 0x80, 0x81,
+  0x81, 0x82, 0x83, 0x84, 0x83, 0x84, 0x85, 0x82, 0x83, 0x83, 0x83, 0x81, 0x81, 0x82, 0x81, 0x84,
+  0x85, 0x83, 0x84, 0x82, 0x84, 0x82, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7e,
+  0x7d, 0x7d, 0x7c, 0x7f, 0x7f, 0x7f, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c,
+  0x7e, 0x7d, 0x7b, 0x7c, 0x7c, 0x7c, 0x7f, 0x7e, 0x80, 0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x82,
+  0x82, 0x7f, 0x81, 0x81, 0x7f, 0x81, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x7d, 0x80, 0x7e, 0x7e, 0x7c,
+  0x7d, 0x80, 0x7f, 0x7e, 0x7d, 0x80, 0x7e, 0x81, 0x7f, 0x7e, 0x7c, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
+  0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x81, 0x80, 0x81, 0x83, 0x81, 0x82, 0x81, 0x81, 0x82,
+  0x81, 0x81, 0x80, 0x81, 0x82, 0x83, 0x82, 0x82, 0x84, 0x82, 0x84, 0x83, 0x82, 0x80, 0x80, 0x81,
+  0x80, 0x7e, 0x7e, 0x80, 0x7f, 0x80, 0x82, 0x80, 0x7e, 0x7e, 0x81, 0x7f, 0x80, 0x81, 0x81, 0x82,
+};
+static const pcm_sample_t sfx_explosion = {sfx_explosion_data, sizeof(sfx_explosion_data)};
+
+static const uint8_t sfx_level_up_data[2640] = {
+  0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1c, 0x1c, 0x1c,
+  0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0xe3,
+  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0xe1, 0xe1,
+  0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x1f, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0,
+  0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0xdf, 0xdf, 0xde,
+  0xde, 0xde, 0xde, 0xde, 0xde, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x23, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xdc, 0xdc, 0xdc, 0xdc,
+  0xdb, 0xdb, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xda, 0xda, 0xda, 0xda, 0xda,
+  0xda, 0xda, 0xda, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9,
+  0xd9, 0xd8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7,
+  0xd7, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
+  0x2a, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4,
+  0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0xd1, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x31, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0x31, 0x31, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0xce, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xcd, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x34, 0x34, 0x34, 0x34, 0x34,
+  0x35, 0x35, 0x35, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0xca, 0xca, 0xca, 0xca, 0xc9, 0xc9, 0xc9, 0xc9, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+  0x37, 0x38, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x38, 0x38, 0x38, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0xc6, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x3c, 0x3c,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0xc1, 0xc1,
+  0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x3f, 0x3f, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0xbf, 0xbf, 0xbf,
+  0xbe, 0xbe, 0xbe, 0xbe, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0xbd, 0xbd, 0xbd, 0xbd,
+  0xbd, 0xbd, 0xbd, 0xbd, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xbb, 0xbb, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0xbb, 0xba, 0xba, 0xba, 0xba,
+  0xba, 0xba, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+  0xb9, 0xb9, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xb8, 0xb8, 0xb8, 0xb8, 0xb7, 0xb7, 0xb7,
+  0xb7, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x4a, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
+  0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xb4, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x4d,
+  0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xe4, 0xe4, 0xe4,
+  0xe4, 0xe4, 0xe4, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1e, 0x1e, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x1e, 0x1e, 0x1e, 0x1f, 0x1f,
+  0x1f, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x1f, 0x1f, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0xe0,
+  0xe0, 0xe0, 0xe0, 0x20, 0x21, 0x21, 0x21, 0x21, 0x21, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xdc, 0xdc,
+  0xdb, 0xdb, 0xdb, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0x27, 0x27, 0x27, 0x27,
+  0x27, 0x28, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x28, 0x28, 0x28, 0x28, 0x29, 0x29, 0xd7, 0xd7,
+  0xd7, 0xd7, 0xd7, 0xd7, 0x29, 0x29, 0x29, 0x2a, 0x2a, 0x2a, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6,
+  0xd6, 0x2a, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0x2c, 0x2c, 0x2c,
+  0x2c, 0x2c, 0x2c, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xd3,
+  0xd3, 0xd3, 0xd3, 0xd2, 0xd2, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1,
+  0xd1, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0xce,
+  0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0x32, 0x32, 0x32, 0x32, 0x33, 0x33, 0xcd, 0xcd, 0xcd, 0xcd,
+  0xcd, 0xcd, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x34, 0x34,
+  0x35, 0x35, 0x35, 0x35, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xc9, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xc8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xc8, 0xc8, 0xc8, 0xc8, 0xc7, 0xc7, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0xc7, 0xc7, 0xc7, 0xc6, 0xc6, 0xc6, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x3a, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0xc4, 0xc4, 0xc4,
+  0xc4, 0xc4, 0xc4, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3e, 0x3e, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x3e, 0x3e, 0x3e, 0x3f, 0x3f,
+  0x3f, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x3f, 0x3f, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x41,
+  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0xbd, 0xbd, 0xbd, 0xbd, 0xbc, 0xbc, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xbc, 0xbc,
+  0xbc, 0xbb, 0xbb, 0xbb, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0xbb, 0xbb, 0xba, 0xba, 0xba, 0xba,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0xba, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x47, 0x47, 0x47, 0x47,
+  0x47, 0x47, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0xb7, 0xb7,
+  0xb7, 0xb7, 0xb7, 0xb7, 0x49, 0x49, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6,
+  0xb6, 0x4a, 0x4a, 0x4b, 0x4b, 0x4b, 0x4b, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x4b, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0xb3,
+  0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xe5, 0xe5, 0xe4, 0xe4, 0xe4,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xe4, 0xe4, 0xe4, 0xe3, 0xe3, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0xe3,
+  0xe3, 0xe3, 0xe3, 0xe2, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x1f, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0,
+  0xe0, 0xe0, 0xe0, 0x20, 0x21, 0x21, 0x21, 0x21, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x21, 0x21, 0x22,
+  0x22, 0x22, 0xde, 0xde, 0xde, 0xde, 0xde, 0x22, 0x22, 0x22, 0x23, 0x23, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0x23, 0x23, 0x23, 0x23, 0x24, 0x24, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x24, 0x24, 0x24, 0x24,
+  0x25, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0xda, 0xda, 0xda, 0xda, 0xda,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0x27, 0x27, 0x27, 0x27, 0x27, 0xd9,
+  0xd9, 0xd8, 0xd8, 0xd8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0xd6, 0xd6,
+  0xd6, 0xd6, 0xd5, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0x2c, 0x2c, 0x2c,
+  0x2c, 0x2c, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xd3, 0xd3, 0xd3,
+  0xd3, 0xd3, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0x2e, 0x2e, 0x2f, 0x2f,
+  0x2f, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0x2f, 0x2f, 0x2f, 0x30, 0x30, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+  0x30, 0x30, 0x30, 0x30, 0x31, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32,
+  0xce, 0xce, 0xce, 0xce, 0xce, 0x32, 0x32, 0x32, 0x32, 0x32, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0x34, 0x34, 0x34, 0x34, 0x34, 0xcc, 0xcc,
+  0xcb, 0xcb, 0xcb, 0x35, 0x35, 0x35, 0x35, 0x35, 0xcb, 0xcb, 0xcb, 0xca, 0xca, 0xca, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0xca, 0xca, 0xca, 0xc9, 0xc9, 0x37, 0x37, 0x37, 0x37, 0x37, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xc8, 0x38, 0x38, 0x38, 0x38, 0x38, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+  0xc6, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x3b, 0x3b, 0x3c, 0x3c, 0x3c,
+  0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3e, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0xc1, 0xc1,
+  0xc1, 0xc1, 0xc1, 0xc1, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0xc0, 0xc0, 0xbf, 0xbf, 0xbf, 0x41, 0x41, 0x41, 0x41, 0x41, 0xbf, 0xbf, 0xbf,
+  0xbe, 0xbe, 0x42, 0x42, 0x42, 0x42, 0x42, 0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbc, 0x44, 0x44, 0x44, 0x44, 0x44, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0x45, 0x45, 0x45, 0x45, 0x45, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0x46, 0x46, 0x47, 0x47, 0x47, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x47,
+  0x47, 0x47, 0x48, 0x48, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x48, 0x48, 0x48, 0x49, 0x49, 0xb7,
+  0xb7, 0xb7, 0xb7, 0xb7, 0x49, 0x49, 0x49, 0x49, 0x4a, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0xb5, 0xb4, 0xb4,
+  0xb4, 0xb4, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xb4, 0xb3, 0xb3, 0xb3, 0xb3, 0x4d, 0x4d, 0x4d,
+  0xe6, 0xe6, 0xe5, 0xe5, 0x1b, 0x1b, 0x1b, 0x1b, 0xe5, 0xe5, 0xe5, 0xe5, 0x1b, 0x1b, 0x1b, 0x1b,
+  0xe5, 0xe5, 0xe5, 0xe5, 0x1b, 0x1c, 0x1c, 0xe4, 0xe4, 0xe4, 0xe4, 0x1c, 0x1c, 0x1c, 0x1c, 0xe4,
+  0xe4, 0xe4, 0xe4, 0x1c, 0x1c, 0x1c, 0x1c, 0xe4, 0xe3, 0xe3, 0xe3, 0x1d, 0x1d, 0x1d, 0xe3, 0xe3,
+  0xe3, 0xe3, 0x1d, 0x1d, 0x1d, 0x1d, 0xe3, 0xe3, 0xe3, 0xe3, 0x1d, 0x1e, 0x1e, 0x1e, 0xe2, 0xe2,
+  0xe2, 0x1e, 0x1e, 0x1e, 0x1e, 0xe2, 0xe2, 0xe2, 0xe2, 0x1e, 0x1e, 0x1e, 0x1e, 0xe2, 0xe1, 0xe1,
+  0xe1, 0x1f, 0x1f, 0x1f, 0x1f, 0xe1, 0xe1, 0xe1, 0x1f, 0x1f, 0x1f, 0x1f, 0xe1, 0xe1, 0xe1, 0xe1,
+  0x1f, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0xe0, 0xe0, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0xe0, 0xe0, 0x20,
+  0x20, 0x20, 0x20, 0xe0, 0xdf, 0xdf, 0xdf, 0x21, 0x21, 0x21, 0x21, 0xdf, 0xdf, 0xdf, 0xdf, 0x21,
+  0x21, 0x21, 0xdf, 0xdf, 0xdf, 0xdf, 0x21, 0x22, 0x22, 0x22, 0xde, 0xde, 0xde, 0xde, 0x22, 0x22,
+  0x22, 0x22, 0xde, 0xde, 0xde, 0x22, 0x22, 0x22, 0x22, 0xde, 0xdd, 0xdd, 0xdd, 0x23, 0x23, 0x23,
+  0x23, 0xdd, 0xdd, 0xdd, 0xdd, 0x23, 0x23, 0x23, 0x23, 0xdd, 0xdd, 0xdd, 0x24, 0x24, 0x24, 0x24,
+  0xdc, 0xdc, 0xdc, 0xdc, 0x24, 0x24, 0x24, 0x24, 0xdc, 0xdc, 0xdc, 0xdc, 0x24, 0x24, 0x24, 0x25,
+  0xdb, 0xdb, 0xdb, 0x25, 0x25, 0x25, 0x25, 0xdb, 0xdb, 0xdb, 0xdb, 0x25, 0x25, 0x25, 0x25, 0xdb,
+  0xdb, 0xdb, 0xda, 0x26, 0x26, 0x26, 0xda, 0xda, 0xda, 0xda, 0x26, 0x26, 0x26, 0x26, 0xda, 0xda,
+  0xda, 0xda, 0x26, 0x26, 0x26, 0x27, 0xd9, 0xd9, 0xd9, 0xd9, 0x27, 0x27, 0x27, 0xd9, 0xd9, 0xd9,
+  0xd9, 0x27, 0x27, 0x27, 0x27, 0xd9, 0xd9, 0xd9, 0xd8, 0x28, 0x28, 0x28, 0x28, 0xd8, 0xd8, 0xd8,
+  0x28, 0x28, 0x28, 0x28, 0xd8, 0xd8, 0xd8, 0xd8, 0x28, 0x28, 0x28, 0x29, 0xd7, 0xd7, 0xd7, 0xd7,
+  0x29, 0x29, 0x29, 0x29, 0xd7, 0xd7, 0xd7, 0x29, 0x29, 0x29, 0x29, 0xd7, 0xd7, 0xd7, 0xd6, 0x2a,
+  0x2a, 0x2a, 0x2a, 0xd6, 0xd6, 0xd6, 0xd6, 0x2a, 0x2a, 0x2a, 0xd6, 0xd6, 0xd6, 0xd6, 0x2a, 0x2a,
+  0x2a, 0x2b, 0xd5, 0xd5, 0xd5, 0xd5, 0x2b, 0x2b, 0x2b, 0x2b, 0xd5, 0xd5, 0xd5, 0xd5, 0x2b, 0x2b,
+  0x2b, 0xd5, 0xd5, 0xd5, 0xd4, 0x2c, 0x2c, 0x2c, 0x2c, 0xd4, 0xd4, 0xd4, 0xd4, 0x2c, 0x2c, 0x2c,
+  0x2c, 0xd4, 0xd4, 0xd4, 0xd4, 0x2c, 0x2c, 0x2d, 0xd3, 0xd3, 0xd3, 0xd3, 0x2d, 0x2d, 0x2d, 0x2d,
+  0xd3, 0xd3, 0xd3, 0xd3, 0x2d, 0x2d, 0x2d, 0x2d, 0xd3, 0xd2, 0xd2, 0x2e, 0x2e, 0x2e, 0x2e, 0xd2,
+  0xd2, 0xd2, 0xd2, 0x2e, 0x2e, 0x2e, 0x2e, 0xd2, 0xd2, 0xd2, 0xd2, 0x2e, 0x2f, 0x2f, 0x2f, 0xd1,
+  0xd1, 0xd1, 0x2f, 0x2f, 0x2f, 0x2f, 0xd1, 0xd1, 0xd1, 0xd1, 0x2f, 0x2f, 0x2f, 0x2f, 0xd1, 0xd0,
+  0xd0, 0xd0, 0x30, 0x30, 0x30, 0xd0, 0xd0, 0xd0, 0xd0, 0x30, 0x30, 0x30, 0x30, 0xd0, 0xd0, 0xd0,
+  0xd0, 0x30, 0x31, 0x31, 0x31, 0xcf, 0xcf, 0xcf, 0xcf, 0x31, 0x31, 0x31, 0xcf, 0xcf, 0xcf, 0xcf,
+  0x31, 0x31, 0x31, 0x31, 0xcf, 0xce, 0xce, 0xce, 0x32, 0x32, 0x32, 0x32, 0xce, 0xce, 0xce, 0x32,
+  0x32, 0x32, 0x32, 0xce, 0xce, 0xce, 0xce, 0x32, 0x33, 0x33, 0x33, 0xcd, 0xcd, 0xcd, 0xcd, 0x33,
+  0x33, 0x33, 0x33, 0xcd, 0xcd, 0xcd, 0x33, 0x33, 0x33, 0x33, 0xcd, 0xcc, 0xcc, 0xcc, 0x34, 0x34,
+  0x34, 0x34, 0xcc, 0xcc, 0xcc, 0xcc, 0x34, 0x34, 0x34, 0x34, 0xcc, 0xcc, 0xcc, 0x34, 0x35, 0x35,
+  0x35, 0xcb, 0xcb, 0xcb, 0xcb, 0x35, 0x35, 0x35, 0x35, 0xcb, 0xcb, 0xcb, 0xcb, 0x35, 0x35, 0x35,
+  0xcb, 0xca, 0xca, 0xca, 0x36, 0x36, 0x36, 0x36, 0xca, 0xca, 0xca, 0xca, 0x36, 0x36, 0x36, 0x36,
+  0xca, 0xca, 0xca, 0xca, 0x37, 0x37, 0x37, 0xc9, 0xc9, 0xc9, 0xc9, 0x37, 0x37, 0x37, 0x37, 0xc9,
+  0xc9, 0xc9, 0xc9, 0x37, 0x37, 0x37, 0x38, 0xc8, 0xc8, 0xc8, 0x38, 0x38, 0x38, 0x38, 0xc8, 0xc8,
+  0xc8, 0xc8, 0x38, 0x38, 0x38, 0x38, 0xc8, 0xc8, 0xc8, 0xc7, 0x39, 0x39, 0x39, 0x39, 0xc7, 0xc7,
+  0xc7, 0x39, 0x39, 0x39, 0x39, 0xc7, 0xc7, 0xc7, 0xc7, 0x39, 0x39, 0x39, 0x3a, 0xc6, 0xc6, 0xc6,
+  0xc6, 0x3a, 0x3a, 0x3a, 0xc6, 0xc6, 0xc6, 0xc6, 0x3a, 0x3a, 0x3a, 0x3a, 0xc6, 0xc6, 0xc6, 0xc5,
+  0x3b, 0x3b, 0x3b, 0x3b, 0xc5, 0xc5, 0xc5, 0xc5, 0x3b, 0x3b, 0x3b, 0xc5, 0xc5, 0xc5, 0xc5, 0x3b,
+  0x3b, 0x3b, 0x3c, 0xc4, 0xc4, 0xc4, 0xc4, 0x3c, 0x3c, 0x3c, 0x3c, 0xc4, 0xc4, 0xc4, 0xc4, 0x3c,
+  0x3c, 0x3c, 0xc4, 0xc4, 0xc4, 0xc3, 0x3d, 0x3d, 0x3d, 0x3d, 0xc3, 0xc3, 0xc3, 0xc3, 0x3d, 0x3d,
+  0x3d, 0x3d, 0xc3, 0xc3, 0xc3, 0x3d, 0x3d, 0x3d, 0x3e, 0xc2, 0xc2, 0xc2, 0xc2, 0x3e, 0x3e, 0x3e,
+  0x3e, 0xc2, 0xc2, 0xc2, 0xc2, 0x3e, 0x3e, 0x3e, 0x3e, 0xc2, 0xc2, 0xc1, 0x3f, 0x3f, 0x3f, 0x3f,
+  0xc1, 0xc1, 0xc1, 0xc1, 0x3f, 0x3f, 0x3f, 0x3f, 0xc1, 0xc1, 0xc1, 0xc1, 0x3f, 0x3f, 0x40, 0xc0,
+  0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xc0,
+  0xc0, 0xbf, 0xbf, 0x41, 0x41, 0x41, 0xbf, 0xbf, 0xbf, 0xbf, 0x41, 0x41, 0x41, 0x41, 0xbf, 0xbf,
+  0xbf, 0xbf, 0x41, 0x42, 0x42, 0x42, 0xbe, 0xbe, 0xbe, 0x42, 0x42, 0x42, 0x42, 0xbe, 0xbe, 0xbe,
+  0xbe, 0x42, 0x42, 0x42, 0x42, 0xbe, 0xbd, 0xbd, 0xbd, 0x43, 0x43, 0x43, 0x43, 0xbd, 0xbd, 0xbd,
+  0x43, 0x43, 0x43, 0x43, 0xbd, 0xbd, 0xbd, 0xbd, 0x43, 0x44, 0x44, 0x44, 0xbc, 0xbc, 0xbc, 0xbc,
+  0x44, 0x44, 0x44, 0x44, 0xbc, 0xbc, 0xbc, 0x44, 0x44, 0x44, 0x44, 0xbc, 0xbb, 0xbb, 0xbb, 0x45,
+  0x45, 0x45, 0x45, 0xbb, 0xbb, 0xbb, 0xbb, 0x45, 0x45, 0x45, 0xbb, 0xbb, 0xbb, 0xbb, 0x45, 0x46,
+  0x46, 0x46, 0xba, 0xba, 0xba, 0xba, 0x46, 0x46, 0x46, 0x46, 0xba, 0xba, 0xba, 0xba, 0x46, 0x46,
+  0x46, 0xba, 0xb9, 0xb9, 0xb9, 0x47, 0x47, 0x47, 0x47, 0xb9, 0xb9, 0xb9, 0xb9, 0x47, 0x47, 0x47,
+  0x47, 0xb9, 0xb9, 0xb9, 0x47, 0x48, 0x48, 0x48, 0xb8, 0xb8, 0xb8, 0xb8, 0x48, 0x48, 0x48, 0x48,
+  0xb8, 0xb8, 0xb8, 0xb8, 0x48, 0x48, 0x48, 0x48, 0xb7, 0xb7, 0xb7, 0x49, 0x49, 0x49, 0x49, 0xb7,
+  0xb7, 0xb7, 0xb7, 0x49, 0x49, 0x49, 0x49, 0xb7, 0xb7, 0xb7, 0xb7, 0x4a, 0x4a, 0x4a, 0xb6, 0xb6,
+  0xb6, 0xb6, 0x4a, 0x4a, 0x4a, 0x4a, 0xb6, 0xb6, 0xb6, 0xb6, 0x4a, 0x4a, 0x4a, 0x4b, 0xb5, 0xb5,
+  0xb5, 0xb5, 0x4b, 0x4b, 0x4b, 0xb5, 0xb5, 0xb5, 0xb5, 0x4b, 0x4b, 0x4b, 0x4b, 0xb5, 0xb5, 0xb5,
+  0xb4, 0x4c, 0x4c, 0x4c, 0x4c, 0xb4, 0xb4, 0xb4, 0xb4, 0x4c, 0x4c, 0x4c, 0xb4, 0xb4, 0xb4, 0xb4,
+  0x4c, 0x4c, 0x4c, 0x4d, 0xb3, 0xb3, 0xb3, 0xb3, 0x4d, 0x4d, 0x4d, 0x4d, 0xb3, 0xb3, 0xb3, 0x4d,
+};
+static const pcm_sample_t sfx_level_up = {sfx_level_up_data, sizeof(sfx_level_up_data)};
+
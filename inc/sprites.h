@@ -0,0 +1,54 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <stdint.h>
+
+// Tiles do campo de jogo no OLED: 16x8 pixels, uma página do SSD1306 (cada
+// byte é uma coluna, bit 0 em cima). Constantes, ficam na flash.
+
+#define SPRITE_WIDTH 16
+
+enum {
+  SPRITE_EMPTY,
+  SPRITE_SHIP,
+  SPRITE_OBSTACLE,
+  SPRITE_CRASH,
+  SPRITE_COUNT
+};
+
+static const uint8_t sprites[SPRITE_COUNT * SPRITE_WIDTH] = {
+  // Vazio
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // Nave
+  // .......##.......
+  // ......####......
+  // ......####......
+  // .....######.....
+  // ...##########...
+  // .##############.
+  // .###..####..###.
+  // .#....#..#....#.
+  0x00, 0xe0, 0x60, 0x70, 0x30, 0x38, 0xfe, 0x7f, 0x7f, 0xfe, 0x38, 0x30, 0x70, 0x60, 0xe0, 0x00,
+  // Obstáculo (asteroide)
+  // .....######.....
+  // ...##########...
+  // ..###.#######...
+  // ..############..
+  // ..#########.##..
+  // ...##########...
+  // ....########....
+  // ................
+  0x00, 0x00, 0x1c, 0x3e, 0x7e, 0x7b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6e, 0x3e, 0x18, 0x00, 0x00,
+  // Colisão
+  // .#....#..#....#.
+  // ..#..#....#..#..
+  // ...#..#..#..#...
+  // #....#....#....#
+  // ...#..#..#..#...
+  // ..#..#....#..#..
+  // .#....#..#....#.
+  // ................
+  0x08, 0x41, 0x22, 0x14, 0x00, 0x2a, 0x55, 0x00, 0x00, 0x55, 0x2a, 0x00, 0x14, 0x22, 0x41, 0x08,
+};
+
+#endif
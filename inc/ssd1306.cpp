@@ -0,0 +1,216 @@
+#include "ssd1306.hpp"
+#include <new>
+
+// Fachada C: ssd1306_init escolhe a especialização pela geometria e pelo
+// endereço e constrói o painel dentro de ssd1306_t; as demais funções só
+// despacham. Cada especialização tem o seu próprio código, com largura,
+// altura e endereço constantes.
+
+using Panel128x64_3C = ssd1306::Panel<128, 64, 0x3C>;
+using Panel128x64_3D = ssd1306::Panel<128, 64, 0x3D>;
+using Panel128x32_3C = ssd1306::Panel<128, 32, 0x3C>;
+using Panel128x32_3D = ssd1306::Panel<128, 32, 0x3D>;
+
+static_assert(sizeof(Panel128x64_3C) <= SSD1306_PANEL_BYTES, "SSD1306_PANEL_BYTES não comporta o painel 128x64");
+static_assert(alignof(Panel128x64_3C) <= alignof(uint64_t), "alinhamento do painel");
+
+template <typename Panel>
+static Panel &panel_at(ssd1306_t *ssd) {
+  return *std::launder(reinterpret_cast<Panel *>(ssd->storage));
+}
+
+template <typename F>
+static auto with_panel(ssd1306_t *ssd, F &&f) {
+  switch (ssd->panel) {
+    case SSD1306_PANEL_128X64_3C: return f(panel_at<Panel128x64_3C>(ssd));
+    case SSD1306_PANEL_128X64_3D: return f(panel_at<Panel128x64_3D>(ssd));
+    case SSD1306_PANEL_128X32_3C: return f(panel_at<Panel128x32_3C>(ssd));
+    case SSD1306_PANEL_128X32_3D: return f(panel_at<Panel128x32_3D>(ssd));
+    default: panic("ssd1306: painel não inicializado");
+  }
+}
+
+template <typename Panel>
+static void panel_create(ssd1306_t *ssd, ssd1306_panel_t kind, bool external_vcc, i2c_inst_t *i2c) {
+  ssd->panel = kind;
+  new (ssd->storage) Panel;
+  panel_at<Panel>(ssd).init(external_vcc, i2c);
+}
+
+// Só 128x64 e 128x32 em 0x3C/0x3D têm especialização; outra geometria ou
+// outro endereço é erro de configuração e para o firmware com panic
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+  ssd->width = width;
+  ssd->height = height;
+  ssd->pages = height / 8U;
+  ssd->address = address;
+  ssd->panel = SSD1306_PANEL_NONE;
+  ssd->baudrate = SSD1306_BAUD_FAST;
+  ssd->frame_bytes = 0;
+  ssd->total_bytes = 0;
+  if (width == 128 && height == 64 && address == 0x3C)
+    panel_create<Panel128x64_3C>(ssd, SSD1306_PANEL_128X64_3C, external_vcc, i2c);
+  else if (width == 128 && height == 64 && address == 0x3D)
+    panel_create<Panel128x64_3D>(ssd, SSD1306_PANEL_128X64_3D, external_vcc, i2c);
+  else if (width == 128 && height == 32 && address == 0x3C)
+    panel_create<Panel128x32_3C>(ssd, SSD1306_PANEL_128X32_3C, external_vcc, i2c);
+  else if (width == 128 && height == 32 && address == 0x3D)
+    panel_create<Panel128x32_3D>(ssd, SSD1306_PANEL_128X32_3D, external_vcc, i2c);
+  else
+    panic("ssd1306_init: painel %ux%u em 0x%02x sem especialização (128x64 ou 128x32, 0x3C ou 0x3D)", width, height, address);
+}
+
+void ssd1306_config(ssd1306_t *ssd) {
+  with_panel(ssd, [](auto &panel) { panel.config(); });
+}
+
+void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  with_panel(ssd, [&](auto &panel) { panel.command(command); });
+}
+
+bool ssd1306_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count) {
+  return with_panel(ssd, [&](auto &panel) { return panel.commands(commands, count); });
+}
+
+void ssd1306_cmdlist_init(ssd1306_cmdlist_t *list, ssd1306_t *ssd) {
+  list->ssd = ssd;
+  list->bytes[0] = 0x00;
+  list->len = 0;
+  list->overflow = false;
+}
+
+// Acrescenta um byte de comando ou argumento; false se a lista estiver cheia
+bool ssd1306_cmdlist_add(ssd1306_cmdlist_t *list, uint8_t byte) {
+  if (list->len >= SSD1306_CMDLIST_MAX) {
+    list->overflow = true;
+    return false;
+  }
+  list->bytes[1 + list->len++] = byte;
+  return true;
+}
+
+// Aguarda o quadro em trânsito e envia a lista com o barramento reservado;
+// true se o painel reconheceu a lista e o quadro anterior não foi recusado
+bool ssd1306_cmdlist_send(ssd1306_cmdlist_t *list) {
+  if (list->overflow || list->len == 0)
+    return false;
+  return with_panel(list->ssd, [&](auto &panel) { return panel.write_commands(list->bytes, 1 + list->len); });
+}
+
+uint ssd1306_negotiate_baudrate(ssd1306_t *ssd, uint max_baudrate) {
+  with_panel(ssd, [&](auto &panel) { ssd->baudrate = panel.negotiate_baudrate(max_baudrate); });
+  return ssd->baudrate;
+}
+
+// Copia as estatísticas do último envio para os campos visíveis ao C
+template <typename Panel>
+static void sync_stats(ssd1306_t *ssd, const Panel &panel) {
+  ssd->frame_bytes = panel.frame_bytes();
+  ssd->total_bytes = panel.total_bytes();
+}
+
+void ssd1306_send_data(ssd1306_t *ssd) {
+  with_panel(ssd, [&](auto &panel) {
+    panel.send_data();
+    sync_stats(ssd, panel);
+  });
+}
+
+bool ssd1306_send_data_async(ssd1306_t *ssd) {
+  return with_panel(ssd, [&](auto &panel) {
+    bool sent = panel.send_data_async();
+    sync_stats(ssd, panel);
+    return sent;
+  });
+}
+
+bool ssd1306_send_busy(ssd1306_t *ssd) {
+  return with_panel(ssd, [](auto &panel) { return panel.send_busy(); });
+}
+
+bool ssd1306_send_failed(ssd1306_t *ssd) {
+  return with_panel(ssd, [](auto &panel) { return panel.send_failed(); });
+}
+
+void ssd1306_send_wait(ssd1306_t *ssd) {
+  with_panel(ssd, [](auto &panel) { panel.send_wait(); });
+}
+
+void ssd1306_set_callback(ssd1306_t *ssd, ssd1306_callback_t callback, void *user_data) {
+  with_panel(ssd, [&](auto &panel) { panel.set_callback(callback, user_data); });
+}
+
+void ssd1306_set_priority(ssd1306_t *ssd, uint8_t priority) {
+  with_panel(ssd, [&](auto &panel) { panel.set_priority(priority); });
+}
+
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line) {
+  with_panel(ssd, [&](auto &panel) { panel.set_start_line(line); });
+}
+
+void ssd1306_ram_pixel(ssd1306_t *ssd, uint8_t x, uint8_t ram_y, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.ram_pixel(x, ram_y, value); });
+}
+
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval) {
+  with_panel(ssd, [&](auto &panel) {
+    panel.scroll_horizontal(left, start_page, end_page, interval);
+    sync_stats(ssd, panel);
+  });
+}
+
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval,
+                             uint8_t vertical_offset, uint8_t fixed_rows, uint8_t scroll_rows) {
+  with_panel(ssd, [&](auto &panel) {
+    panel.scroll_diagonal(left, start_page, end_page, interval, vertical_offset, fixed_rows, scroll_rows);
+    sync_stats(ssd, panel);
+  });
+}
+
+void ssd1306_scroll_stop(ssd1306_t *ssd) {
+  with_panel(ssd, [](auto &panel) { panel.scroll_stop(); });
+}
+
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  with_panel(ssd, [&](auto &panel) { panel.mark_dirty(x0, y0, x1, y1); });
+}
+
+void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.pixel(x, y, value); });
+}
+
+void ssd1306_fill(ssd1306_t *ssd, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.fill(value); });
+}
+
+void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
+  with_panel(ssd, [&](auto &panel) { panel.rect(top, left, width, height, value, fill); });
+}
+
+void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.line(x0, y0, x1, y1, value); });
+}
+
+void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.hline(x0, x1, y, value); });
+}
+
+void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+  with_panel(ssd, [&](auto &panel) { panel.vline(x, y0, y1, value); });
+}
+
+void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *columns, uint8_t count, uint8_t x, uint8_t y) {
+  with_panel(ssd, [&](auto &panel) { panel.draw_bitmap(columns, count, x, y); });
+}
+
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y) {
+  with_panel(ssd, [&](auto &panel) { panel.draw_char(c, x, y); });
+}
+
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y) {
+  with_panel(ssd, [&](auto &panel) { panel.draw_string(str, x, y); });
+}
+
+void ssd1306_draw_string_cached(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y) {
+  with_panel(ssd, [&](auto &panel) { panel.draw_string_cached(str, x, y); });
+}
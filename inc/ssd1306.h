@@ -1,9 +1,24 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "i2c_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_MAX_PAGES 8
+#define SSD1306_STRING_CACHE_SLOTS 4
+#define SSD1306_STRING_CACHE_LEN 16
+#define SSD1306_CMDLIST_MAX 32          // Bytes de comando (e argumentos) por transação
+#define SSD1306_BAUD_FAST 400000        // Fast-mode, limite do datasheet
+#define SSD1306_BAUD_FAST_PLUS 1000000  // Fast-mode Plus, aceito por muitos painéis
+#define SSD1306_DATA_CHUNK 128          // Bytes por transação de dados (ponto de troca no barramento)
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -22,22 +37,87 @@ typedef enum {
   SET_DISP_CLK_DIV = 0xD5,
   SET_PRECHARGE = 0xD9,
   SET_VCOM_DESEL = 0xDB,
-  SET_CHARGE_PUMP = 0x8D
+  SET_CHARGE_PUMP = 0x8D,
+  SET_NOP = 0xE3,
+  SET_HSCROLL_RIGHT = 0x26,
+  SET_HSCROLL_LEFT = 0x27,
+  SET_VHSCROLL_RIGHT = 0x29,
+  SET_VHSCROLL_LEFT = 0x2A,
+  SET_SCROLL_OFF = 0x2E,
+  SET_SCROLL_ON = 0x2F,
+  SET_VSCROLL_AREA = 0xA3
 } ssd1306_command_t;
 
+// Intervalo entre passos da rolagem contínua, em quadros do oscilador do painel
+typedef enum {
+  SSD1306_SCROLL_2_FRAMES = 7,
+  SSD1306_SCROLL_3_FRAMES = 4,
+  SSD1306_SCROLL_4_FRAMES = 5,
+  SSD1306_SCROLL_5_FRAMES = 0,
+  SSD1306_SCROLL_25_FRAMES = 6,
+  SSD1306_SCROLL_64_FRAMES = 1,
+  SSD1306_SCROLL_128_FRAMES = 2,
+  SSD1306_SCROLL_256_FRAMES = 3
+} ssd1306_scroll_interval_t;
+
+typedef void (*ssd1306_callback_t)(void *user_data);
+
+// Painéis com código especializado (ssd1306.hpp): 128x64 e 128x32, em 0x3C ou 0x3D
+typedef enum {
+  SSD1306_PANEL_NONE,             // Antes de ssd1306_init: qualquer chamada termina em panic
+  SSD1306_PANEL_128X64_3C,
+  SSD1306_PANEL_128X64_3D,
+  SSD1306_PANEL_128X32_3C,
+  SSD1306_PANEL_128X32_3D
+} ssd1306_panel_t;
+
+// Espaço do driver especializado dentro de ssd1306_t (framebuffer, front
+// buffer e estado do envio), dimensionado para o maior painel, 128x64
+#define SSD1306_PANEL_BYTES 3584
+
+// Fachada C do driver de ssd1306.hpp: o painel vive dentro da estrutura,
+// sem alocação, e cada função despacha para a especialização da geometria
 typedef struct {
   uint8_t width, height, pages, address;
-  i2c_inst_t *i2c_port;
-  bool external_vcc;
-  uint8_t *ram_buffer;
-  size_t bufsize;
-  uint8_t port_buffer[2];
+  ssd1306_panel_t panel;
+  uint baudrate;            // Taxa do barramento após ssd1306_negotiate_baudrate
+  uint16_t frame_bytes;     // Bytes enviados no último quadro (comandos + dados)
+  uint32_t total_bytes;     // Bytes enviados desde a inicialização
+  uint64_t storage[SSD1306_PANEL_BYTES / sizeof(uint64_t)];
 } ssd1306_t;
 
+// Lista de comandos enviada numa única transação, com um só byte de
+// controle 0x00 (Co = 0, D/C = 0) na frente
+typedef struct {
+  ssd1306_t *ssd;
+  uint8_t len;
+  bool overflow;
+  uint8_t bytes[1 + SSD1306_CMDLIST_MAX];
+} ssd1306_cmdlist_t;
+
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+bool ssd1306_commands(ssd1306_t *ssd, const uint8_t *commands, size_t count);
+void ssd1306_cmdlist_init(ssd1306_cmdlist_t *list, ssd1306_t *ssd);
+bool ssd1306_cmdlist_add(ssd1306_cmdlist_t *list, uint8_t byte);
+bool ssd1306_cmdlist_send(ssd1306_cmdlist_t *list);
+uint ssd1306_negotiate_baudrate(ssd1306_t *ssd, uint max_baudrate);
+
+void ssd1306_set_start_line(ssd1306_t *ssd, uint8_t line);
+void ssd1306_ram_pixel(ssd1306_t *ssd, uint8_t x, uint8_t ram_y, bool value);
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval);
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval,
+                             uint8_t vertical_offset, uint8_t fixed_rows, uint8_t scroll_rows);
+void ssd1306_scroll_stop(ssd1306_t *ssd);
 void ssd1306_send_data(ssd1306_t *ssd);
+bool ssd1306_send_data_async(ssd1306_t *ssd);
+bool ssd1306_send_busy(ssd1306_t *ssd);
+bool ssd1306_send_failed(ssd1306_t *ssd);
+void ssd1306_send_wait(ssd1306_t *ssd);
+void ssd1306_set_callback(ssd1306_t *ssd, ssd1306_callback_t callback, void *user_data);
+void ssd1306_set_priority(ssd1306_t *ssd, uint8_t priority);
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -45,5 +125,13 @@ void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
+void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *columns, uint8_t count, uint8_t x, uint8_t y);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+void ssd1306_draw_string_cached(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,714 @@
+#ifndef SSD1306_HPP
+#define SSD1306_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "font.h"
+
+// Driver do SSD1306 especializado em tempo de compilação para a geometria
+// do painel e o endereço I2C. Páginas, tamanho do framebuffer e a sequência
+// de inicialização são constantes: o endereçamento dos pixels vira
+// deslocamentos fixos e os laços por página têm limite conhecido pelo
+// compilador. Framebuffer e front buffer são membros de tamanho fixo.
+//
+// O código C usa a fachada de ssd1306.h, que guarda o painel dentro de
+// ssd1306_t e despacha para a especialização escolhida em ssd1306_init.
+
+namespace ssd1306 {
+
+// Cache de strings pré-renderizadas, comum a todos os painéis: textos
+// estáticos (títulos, rótulos) são convertidos em colunas uma única vez e
+// depois copiados diretamente.
+struct CachedString {
+  char text[SSD1306_STRING_CACHE_LEN + 1];
+  uint8_t columns[SSD1306_STRING_CACHE_LEN * 8];
+  uint8_t count;
+};
+
+inline CachedString string_cache[SSD1306_STRING_CACHE_SLOTS];
+inline uint8_t string_cache_next = 0;
+
+inline const uint8_t *glyph(char c) {
+  if (c < ' ' || c > '~')
+    c = ' ';
+  return &font[(c - ' ') * 8];
+}
+
+inline const CachedString *cache_lookup(const char *str) {
+  for (uint8_t i = 0; i < SSD1306_STRING_CACHE_SLOTS; ++i) {
+    if (string_cache[i].count && strcmp(string_cache[i].text, str) == 0)
+      return &string_cache[i];
+  }
+
+  size_t len = strlen(str);
+  if (len == 0 || len > SSD1306_STRING_CACHE_LEN)
+    return nullptr;
+
+  // Substituição circular: o cache é pequeno e os textos mudam pouco
+  CachedString *slot = &string_cache[string_cache_next];
+  string_cache_next = (string_cache_next + 1) % SSD1306_STRING_CACHE_SLOTS;
+  memcpy(slot->text, str, len + 1);
+  for (size_t i = 0; i < len; ++i)
+    memcpy(&slot->columns[i * 8], glyph(str[i]), 8);
+  slot->count = len * 8;
+  return slot;
+}
+
+// Máscara das linhas y0..y1 dentro da página que contém y0
+constexpr uint8_t page_mask(uint8_t y0, uint8_t y1) {
+  return (0xFF << (y0 & 7)) & (0xFF >> (7 - (y1 & 7)));
+}
+
+template <uint8_t Width, uint8_t Height, uint8_t Address>
+class Panel {
+  static_assert(Height % 8 == 0 && Height / 8 <= SSD1306_MAX_PAGES, "a altura deve ocupar páginas inteiras");
+  static_assert(Width > 0 && Width <= 128, "o SSD1306 tem 128 colunas");
+
+public:
+  static constexpr uint8_t kWidth = Width;
+  static constexpr uint8_t kHeight = Height;
+  static constexpr uint8_t kAddress = Address;
+  static constexpr uint8_t kPages = Height / 8;
+  static constexpr size_t kBufsize = kPages * Width;
+
+  // Janela de cada trecho: controle 0x00 + 6 bytes de comando (transação
+  // própria) e o controle 0x40 que abre a transação de dados
+  static constexpr uint kWindowWords = 8;
+  // Custo da janela no barramento: as palavras acima mais o endereço da
+  // segunda transação
+  static constexpr uint kWindowCost = kWindowWords + 1;
+  // Lista com a nova linha inicial, anexada ao fim do quadro
+  static constexpr uint kStartLineWords = 2;
+  // Configuração da rolagem contínua (área vertical, 6 bytes e o 2Fh)
+  static constexpr uint kScrollSetupMax = 10;
+  // Pausa da rolagem em volta dos dados: 2Eh antes, configuração + 2Fh depois
+  static constexpr uint kScrollPauseWords = 2 + 1 + kScrollSetupMax;
+  static constexpr size_t kFrontWords = kPages * (kWindowWords + Width) + kBufsize / SSD1306_DATA_CHUNK + kStartLineWords +
+                                        kScrollPauseWords;
+
+  // Sequência de inicialização inteira numa única transação. Só o painel de
+  // 64 linhas usa a configuração alternada dos pinos COM.
+  static constexpr uint8_t kInitSequence[] = {
+    SET_DISP | 0x00,
+    SET_MEM_ADDR, 0x00,
+    SET_DISP_START_LINE | 0x00,
+    SET_SEG_REMAP | 0x01,
+    SET_MUX_RATIO, Height - 1,
+    SET_COM_OUT_DIR | 0x08,
+    SET_DISP_OFFSET, 0x00,
+    SET_COM_PIN_CFG, Height == 64 ? 0x12 : 0x02,
+    SET_DISP_CLK_DIV, 0x80,
+    SET_PRECHARGE, 0xF1,
+    SET_VCOM_DESEL, 0x30,
+    SET_CONTRAST, 0xFF,
+    SET_ENTIRE_ON,
+    SET_NORM_INV,
+    SET_CHARGE_PUMP, 0x14,
+    SET_DISP | 0x01
+  };
+  static_assert(sizeof(kInitSequence) <= SSD1306_CMDLIST_MAX, "a sequência cabe numa lista de comandos");
+
+  void init(bool external_vcc, i2c_inst_t *i2c) {
+    i2c_port_ = i2c;
+    external_vcc_ = external_vcc;
+    memset(ram_, 0, sizeof(ram_));
+    front_len_ = 0;
+    frame_bytes_ = 0;
+    total_bytes_ = 0;
+    for (uint8_t p = 0; p < kPages; ++p) {
+      dirty_x0_[p] = 0;
+      dirty_x1_[p] = Width - 1;
+    }
+    callback_ = nullptr;
+    callback_data_ = nullptr;
+    baudrate_ = SSD1306_BAUD_FAST;
+    start_line_ = 0;
+    start_line_pending_ = false;
+    scroll_pages_ = 0;
+    scroll_setup_len_ = 0;
+    priority_ = I2C_PRIORITY_NORMAL;
+    i2c_bus_add_device(i2c_bus_get(i2c), &device_, Address);
+    i2c_transfer_init(&transfer_, &device_, transfer_done, this);
+  }
+
+  void config() {
+    commands(kInitSequence, sizeof(kInitSequence));
+  }
+
+  void command(uint8_t command) {
+    commands(&command, 1);
+  }
+
+  // Envia os comandos (com seus argumentos) numa transação, com um só byte
+  // de controle 0x00 na frente. Retorna false se o painel não respondeu ou
+  // se não couberem numa lista.
+  bool commands(const uint8_t *commands, size_t count) {
+    uint8_t bytes[1 + SSD1306_CMDLIST_MAX];
+    if (count == 0 || count > SSD1306_CMDLIST_MAX)
+      return false;
+    bytes[0] = 0x00;
+    memcpy(&bytes[1], commands, count);
+    return write_commands(bytes, 1 + count);
+  }
+
+  // Aguarda o quadro em trânsito e escreve a transação (controle incluído)
+  // com o barramento reservado; true se o painel reconheceu a transação e
+  // o quadro que a precedia (comandos sobre um quadro recusado deixariam a
+  // tela num estado que quem chama não espera)
+  bool write_commands(const uint8_t *bytes, size_t len) {
+    send_wait();
+    i2c_bus_acquire(device_.bus);
+    int written = i2c_write_blocking(i2c_port_, Address, bytes, len, false);
+    i2c_bus_release(device_.bus);
+    return written == (int) len && !send_failed();
+  }
+
+  // Sobe o barramento até max_baudrate (ex.: SSD1306_BAUD_FAST_PLUS) e sonda o
+  // painel com NOPs; se ele não reconhecer (NAK) nessa taxa, volta a 400 kHz.
+  // A taxa vale para o barramento inteiro: com vários painéis, negocie com
+  // todos e use a menor. Retorna a taxa em uso.
+  uint negotiate_baudrate(uint max_baudrate) {
+    static constexpr uint8_t probe[] = {SET_NOP, SET_NOP, SET_NOP, SET_NOP};
+    send_wait();
+    if (max_baudrate > SSD1306_BAUD_FAST) {
+      set_baudrate(max_baudrate);
+      if (commands(probe, sizeof(probe)))
+        return baudrate_;
+    }
+    return set_baudrate(MIN(max_baudrate, SSD1306_BAUD_FAST));
+  }
+
+  void send_data() {
+    send_wait();
+    send_data_async();
+    send_wait();
+  }
+
+  // Copia as regiões alteradas do back buffer para o front buffer e o entrega
+  // à fila do barramento. Páginas vizinhas são agrupadas numa única janela quando isso
+  // transmite menos bytes do que enviá-las separadamente.
+  // Retorna false, sem bloquear, se o quadro anterior ainda estiver em trânsito.
+  bool send_data_async() {
+    if (send_busy())
+      return false;
+
+    // Com a rolagem contínua ativa a GDDRAM não pode ser acessada: os dados
+    // vão entre um 2Eh e a mesma configuração seguida do 2Fh, no mesmo quadro
+    uint16_t *word = front_;
+    if (scroll_pages_) {
+      *word++ = 0x00;
+      *word++ = SET_SCROLL_OFF | I2C_IC_DATA_CMD_STOP_BITS;
+    }
+    uint16_t *data = word;
+    uint8_t p = 0;
+    while (p < kPages) {
+      // Páginas sob rolagem contínua pertencem ao controlador: ficam sujas
+      // até scroll_stop
+      if (dirty_x0_[p] > dirty_x1_[p] || (scroll_pages_ >> p) & 1) {
+        ++p;
+        continue;
+      }
+      uint8_t p1 = p;
+      uint8_t x0 = dirty_x0_[p], x1 = dirty_x1_[p];
+      uint16_t cost = kWindowCost + x1 - x0 + 1;
+      while (p1 + 1 < kPages && dirty_x0_[p1 + 1] <= dirty_x1_[p1 + 1] && !((scroll_pages_ >> (p1 + 1)) & 1)) {
+        uint8_t nx0 = MIN(x0, dirty_x0_[p1 + 1]);
+        uint8_t nx1 = MAX(x1, dirty_x1_[p1 + 1]);
+        uint16_t separate = cost + kWindowCost + dirty_x1_[p1 + 1] - dirty_x0_[p1 + 1] + 1;
+        uint16_t merged = kWindowCost + (nx1 - nx0 + 1) * (p1 + 2 - p);
+        if (merged > separate)
+          break;
+        x0 = nx0;
+        x1 = nx1;
+        cost = merged;
+        ++p1;
+      }
+      word = emit_span(word, x0, x1, p, p1);
+      for (; p <= p1; ++p) {
+        dirty_x0_[p] = 0xFF;
+        dirty_x1_[p] = 0;
+      }
+    }
+    if (scroll_pages_) {
+      if (word == data) {
+        word = front_;  // Nada a gravar: a rolagem segue sem pausa
+      } else {
+        *word++ = 0x00;
+        for (uint8_t i = 0; i < scroll_setup_len_; ++i)
+          *word++ = scroll_setup_[i];
+        word[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+      }
+    }
+    if (start_line_pending_) {
+      // A linha inicial muda logo depois dos dados: o fundo rola no mesmo
+      // instante em que os sprites redesenhados chegam ao painel
+      *word++ = 0x00;
+      *word++ = (SET_DISP_START_LINE | start_line_) | I2C_IC_DATA_CMD_STOP_BITS;
+      start_line_pending_ = false;
+    }
+    front_len_ = word - front_;
+    frame_bytes_ = front_len_;
+    total_bytes_ += front_len_;
+    return i2c_bus_submit(&transfer_, front_, front_len_, priority_);
+  }
+
+  // Indica se o front buffer ainda está na fila ou em trânsito
+  bool send_busy() const {
+    return i2c_transfer_busy(&transfer_);
+  }
+
+  // Indica se o último envio do front buffer terminou num abort (NAK):
+  // o painel não recebeu o quadro inteiro
+  bool send_failed() const {
+    return i2c_transfer_failed(&transfer_);
+  }
+
+  // Aguarda o front buffer inteiro sair no fio (STOP do último trecho)
+  void send_wait() const {
+    while (send_busy())
+      tight_loop_contents();
+  }
+
+  void set_callback(ssd1306_callback_t callback, void *user_data) {
+    callback_ = callback;
+    callback_data_ = user_data;
+  }
+
+  // Prioridade dos envios deste painel na fila do barramento: um painel de
+  // placar com I2C_PRIORITY_URGENT passa à frente dos quadros de outro painel
+  void set_priority(uint8_t priority) {
+    priority_ = priority;
+  }
+
+  uint baudrate() const { return baudrate_; }
+  uint16_t frame_bytes() const { return frame_bytes_; }
+  uint32_t total_bytes() const { return total_bytes_; }
+
+  // -------------------------------------------------------------- rolagem
+  // As rotinas de desenho recebem coordenadas da tela; com a linha inicial
+  // em start_line, a linha y da tela é a linha (y + start_line) da GDDRAM.
+  // Um retângulo da tela vira no máximo dois trechos contínuos da GDDRAM.
+
+  // Muda a linha da GDDRAM exibida no topo. O comando segue com o próximo
+  // envio; o que já está na GDDRAM (o fundo) rola junto, e os desenhos
+  // seguintes já usam o novo deslocamento. Sprites devem ser apagados antes.
+  void set_start_line(uint8_t line) {
+    start_line_ = line % Height;
+    start_line_pending_ = true;
+  }
+
+  // Rolagem horizontal contínua das páginas start..end, feita pelo próprio
+  // controlador sem tráfego no barramento. A GDDRAM dessas páginas gira e
+  // deixa de corresponder ao framebuffer, por isso os envios as ignoram até
+  // scroll_stop. Os envios das outras páginas pausam a rolagem (2Eh) e a
+  // retomam com a mesma configuração; as páginas roladas continuam de onde
+  // estavam. O quadro pendente é enviado antes.
+  void scroll_horizontal(bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval) {
+    const uint8_t setup[] = {
+      (uint8_t) (left ? SET_HSCROLL_LEFT : SET_HSCROLL_RIGHT), 0x00, start_page, (uint8_t) interval, end_page, 0x00, 0xFF,
+      SET_SCROLL_ON
+    };
+    scroll_start(setup, sizeof(setup), start_page, end_page);
+  }
+
+  // Rolagem diagonal contínua: horizontal nas páginas start..end e vertical
+  // de vertical_offset linhas por passo dentro da área fixed_rows/scroll_rows
+  // (as fixed_rows primeiras linhas não se movem)
+  void scroll_diagonal(bool left, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval,
+                       uint8_t vertical_offset, uint8_t fixed_rows, uint8_t scroll_rows) {
+    const uint8_t setup[] = {
+      SET_VSCROLL_AREA, fixed_rows, scroll_rows,
+      (uint8_t) (left ? SET_VHSCROLL_LEFT : SET_VHSCROLL_RIGHT), 0x00, start_page, (uint8_t) interval, end_page, vertical_offset,
+      SET_SCROLL_ON
+    };
+    scroll_start(setup, sizeof(setup), start_page, end_page);
+  }
+
+  // Para a rolagem contínua. O datasheet exige regravar a GDDRAM depois do
+  // 2Eh: as páginas roladas voltam a ser enviadas por inteiro e a linha
+  // inicial (alterada pela rolagem vertical) é reenviada.
+  void scroll_stop() {
+    command(SET_SCROLL_OFF);
+    for (uint8_t p = 0; p < kPages; ++p) {
+      if ((scroll_pages_ >> p) & 1) {
+        dirty_x0_[p] = 0;
+        dirty_x1_[p] = Width - 1;
+      }
+    }
+    scroll_pages_ = 0;
+    start_line_pending_ = true;
+  }
+
+  // -------------------------------------------------------------- desenho
+  // Marca o retângulo (inclusivo, em coordenadas da tela) como alterado desde o último envio
+  void mark_dirty(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    if (x0 >= Width || y0 >= Height)
+      return;
+    if (x1 >= Width)
+      x1 = Width - 1;
+    if (y1 >= Height)
+      y1 = Height - 1;
+    uint8_t r0 = ram_row(y0);
+    uint r1 = r0 + (y1 - y0);
+    if (r1 < Height) {
+      mark_ram_dirty(x0, r0, x1, r1);
+    } else {
+      mark_ram_dirty(x0, r0, x1, Height - 1);
+      mark_ram_dirty(x0, 0, x1, r1 - Height);
+    }
+  }
+
+  // Pixel em coordenadas da GDDRAM: rola junto com a linha inicial (fundo)
+  void ram_pixel(uint8_t x, uint8_t ram_y, bool value) {
+    if (x >= Width || ram_y >= Height)
+      return;
+    ram_pixel_raw(x, ram_y, value);
+    mark_ram_dirty(x, ram_y, x, ram_y);
+  }
+
+  void pixel(uint8_t x, uint8_t y, bool value) {
+    pixel_raw(x, y, value);
+    mark_dirty(x, y, x, y);
+  }
+
+  // A tela inteira é a GDDRAM inteira, qualquer que seja a linha inicial
+  void fill(bool value) {
+    memset(ram_, value ? 0xFF : 0x00, kBufsize);
+    for (uint8_t p = 0; p < kPages; ++p) {
+      dirty_x0_[p] = 0;
+      dirty_x1_[p] = Width - 1;
+    }
+  }
+
+  void rect(uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
+    if (width == 0 || height == 0)
+      return;
+    int right = left + width - 1;
+    int bottom = top + height - 1;
+
+    if (fill) {
+      fill_area(left, top, right, bottom, value);
+      return;
+    }
+    fill_area(left, top, right, top, value);
+    fill_area(left, bottom, right, bottom, value);
+    fill_area(left, top, left, bottom, value);
+    fill_area(right, top, right, bottom, value);
+  }
+
+  void line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+    // Linhas retas usam os preenchimentos por página
+    if (y0 == y1) {
+      hline(x0, x1, y0, value);
+      return;
+    }
+    if (x0 == x1) {
+      vline(x0, y0, y1, value);
+      return;
+    }
+
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+    int err = dx - dy;
+
+    mark_dirty(MIN(x0, x1), MIN(y0, y1), MAX(x0, x1), MAX(y0, y1));
+    while (true) {
+      pixel_raw(x0, y0, value); // Desenha o pixel atual (recortado)
+      if (x0 == x1 && y0 == y1)
+        break;
+      int e2 = err * 2;
+      if (e2 > -dy) {
+        err -= dy;
+        x0 += sx;
+      }
+      if (e2 < dx) {
+        err += dx;
+        y0 += sy;
+      }
+    }
+  }
+
+  void hline(uint8_t x0, uint8_t x1, uint8_t y, bool value) {
+    fill_area(MIN(x0, x1), y, MAX(x0, x1), y, value);
+  }
+
+  void vline(uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+    fill_area(x, MIN(y0, y1), x, MAX(y0, y1), value);
+  }
+
+  // Desenha um bitmap de uma página de altura (tiles, sprites): 'count' colunas
+  // de 8 pixels a partir de (x, y)
+  void draw_bitmap(const uint8_t *columns, uint8_t count, uint8_t x, uint8_t y) {
+    blit_columns(columns, count, x, y);
+  }
+
+  void draw_char(char c, uint8_t x, uint8_t y) {
+    blit_columns(glyph(c), 8, x, y);
+  }
+
+  void draw_string(const char *str, uint8_t x, uint8_t y) {
+    while (*str) {
+      draw_char(*str++, x, y);
+      x += 8;
+      if (x + 8 >= Width) {
+        x = 0;
+        y += 8;
+      }
+      if (y + 8 >= Height)
+        break;
+    }
+  }
+
+  // Desenha uma string numa única linha usando o cache; textos maiores que o
+  // cache recaem em draw_string
+  void draw_string_cached(const char *str, uint8_t x, uint8_t y) {
+    const CachedString *cached = cache_lookup(str);
+    if (cached)
+      blit_columns(cached->columns, cached->count, x, y);
+    else
+      draw_string(str, x, y);
+  }
+
+private:
+  // Fim do envio do front buffer (interrupção do barramento)
+  static void transfer_done(i2c_transfer_t *transfer, void *user_data) {
+    Panel *panel = static_cast<Panel *>(user_data);
+    (void) transfer;
+    if (panel->callback_)
+      panel->callback_(panel->callback_data_);
+  }
+
+  uint set_baudrate(uint baudrate) {
+    i2c_bus_acquire(device_.bus);
+    baudrate_ = i2c_set_baudrate(i2c_port_, baudrate);
+    i2c_bus_release(device_.bus);
+    return baudrate_;
+  }
+
+  // Envia o quadro pendente, troca a rolagem e guarda a configuração para
+  // as pausas de send_data_async
+  void scroll_start(const uint8_t *setup, uint8_t len, uint8_t start_page, uint8_t end_page) {
+    uint8_t list[1 + kScrollSetupMax];
+    send_data();
+    list[0] = SET_SCROLL_OFF;
+    memcpy(&list[1], setup, len);
+    commands(list, 1 + len);
+    memcpy(scroll_setup_, setup, len);
+    scroll_setup_len_ = len;
+    scroll_pages_ = (0xFF >> (7 - end_page)) & (0xFF << start_page);
+  }
+
+  // Monta uma transação: janela de colunas/páginas seguida dos dados da região
+  uint16_t *emit_span(uint16_t *word, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    const uint8_t window[] = {
+      SET_COL_ADDR, x0, x1,
+      SET_PAGE_ADDR, p0, p1
+    };
+    // Lista de comandos da janela: o STOP no último byte encerra a transação
+    // e o controlador abre a de dados logo em seguida (START + endereço)
+    *word++ = 0x00;
+    for (uint8_t i = 0; i < sizeof(window); ++i)
+      *word++ = window[i];
+    word[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    *word++ = 0x40;
+    // Endereçamento horizontal: cada página percorre as colunas x0..x1. Os
+    // dados vão em transações de até SSD1306_DATA_CHUNK bytes; o ponteiro do
+    // painel continua de uma para a outra, e cada STOP é um ponto em que o
+    // barramento pode atender outro dispositivo.
+    uint16_t chunk = 0;
+    for (uint8_t p = p0; p <= p1; ++p) {
+      const uint8_t *row = &ram_[p * Width];
+      for (uint8_t x = x0; x <= x1; ++x) {
+        if (chunk == SSD1306_DATA_CHUNK) {
+          word[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+          *word++ = 0x40;
+          chunk = 0;
+        }
+        *word++ = row[x];
+        ++chunk;
+      }
+    }
+    word[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return word;
+  }
+
+  // Com altura potência de 2 a volta da GDDRAM é uma máscara
+  uint8_t ram_row(uint8_t y) const {
+    if constexpr ((Height & (Height - 1)) == 0) {
+      return (y + start_line_) & (Height - 1);
+    } else {
+      uint8_t row = y + start_line_;
+      return row >= Height ? row - Height : row;
+    }
+  }
+
+  // Marca linhas ram_y0..ram_y1 da GDDRAM (sem volta) como alteradas
+  void mark_ram_dirty(uint8_t x0, uint8_t ram_y0, uint8_t x1, uint8_t ram_y1) {
+    for (uint8_t p = ram_y0 >> 3; p <= (ram_y1 >> 3); ++p) {
+      if (x0 < dirty_x0_[p])
+        dirty_x0_[p] = x0;
+      if (x1 > dirty_x1_[p])
+        dirty_x1_[p] = x1;
+    }
+  }
+
+  void ram_pixel_raw(uint8_t x, uint8_t ram_y, bool value) {
+    uint8_t &byte = ram_[(ram_y >> 3) * Width + x];
+    uint8_t bit = 1 << (ram_y & 0b111);
+    if (value)
+      byte |= bit;
+    else
+      byte &= ~bit;
+  }
+
+  void pixel_raw(uint8_t x, uint8_t y, bool value) {
+    if (x >= Width || y >= Height)
+      return;
+    ram_pixel_raw(x, ram_row(y), value);
+  }
+
+  // Liga ou desliga 'mask32' na palavra alinhada em 'byte'. A cópia por
+  // memcpy evita acessar ram_ por um uint32_t* (aliasing estrito); com o
+  // alinhamento declarado, vira um único ldr/str.
+  static void update_word(uint8_t *byte, uint32_t mask32, bool value) {
+    uint8_t *aligned = static_cast<uint8_t *>(__builtin_assume_aligned(byte, 4));
+    uint32_t word;
+    memcpy(&word, aligned, sizeof(word));
+    word = value ? (word | mask32) : (word & ~mask32);
+    memcpy(aligned, &word, sizeof(word));
+  }
+
+  // Aplica a máscara de linhas 'mask' às colunas x0..x1 (já recortadas) de uma
+  // página. Bytes inteiros usam memset; os demais usam palavras de 32 bits onde
+  // o alinhamento permite.
+  void span(uint8_t page, uint8_t x0, uint8_t x1, uint8_t mask, bool value) {
+    uint8_t *byte = &ram_[page * Width + x0];
+    uint8_t *end = byte + (x1 - x0) + 1;
+
+    if (mask == 0xFF) {
+      memset(byte, value ? 0xFF : 0x00, end - byte);
+      return;
+    }
+
+    uint32_t mask32 = mask * 0x01010101u;
+    if (value) {
+      while (byte < end && ((uintptr_t) byte & 3))
+        *byte++ |= mask;
+      for (; byte + 4 <= end; byte += 4)
+        update_word(byte, mask32, true);
+      while (byte < end)
+        *byte++ |= mask;
+    } else {
+      while (byte < end && ((uintptr_t) byte & 3))
+        *byte++ &= ~mask;
+      for (; byte + 4 <= end; byte += 4)
+        update_word(byte, mask32, false);
+      while (byte < end)
+        *byte++ &= ~mask;
+    }
+  }
+
+  // Preenche as colunas x0..x1 das linhas ram_y0..ram_y1 da GDDRAM (sem volta)
+  void fill_rows(uint8_t x0, uint8_t x1, uint8_t ram_y0, uint8_t ram_y1, bool value) {
+    uint8_t first = ram_y0 >> 3, last = ram_y1 >> 3;
+    for (uint8_t page = first; page <= last; ++page) {
+      uint8_t top = (page == first) ? ram_y0 : page << 3;
+      uint8_t bottom = (page == last) ? ram_y1 : (page << 3) + 7;
+      span(page, x0, x1, page_mask(top, bottom), value);
+    }
+    mark_ram_dirty(x0, ram_y0, x1, ram_y1);
+  }
+
+  // Preenche o retângulo inclusivo (x0, y0)-(x1, y1), recortado à tela
+  void fill_area(int x0, int y0, int x1, int y1, bool value) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= Width) x1 = Width - 1;
+    if (y1 >= Height) y1 = Height - 1;
+    if (x0 > x1 || y0 > y1)
+      return;
+
+    uint8_t r0 = ram_row(y0);
+    uint r1 = r0 + (y1 - y0);
+    if (r1 < Height) {
+      fill_rows(x0, x1, r0, r1, value);
+    } else {
+      fill_rows(x0, x1, r0, Height - 1, value);
+      fill_rows(x0, x1, 0, r1 - Height, value);
+    }
+  }
+
+  // Grava os bits first..first+rows-1 de cada coluna a partir da linha ram_y
+  // da GDDRAM (o trecho não passa do fim da memória). Com a linha alinhada à
+  // página cada coluna é um único byte; caso contrário é deslocada e mesclada
+  // nas duas páginas que ocupa.
+  void blit_rows(const uint8_t *columns, uint8_t count, uint8_t x, uint8_t ram_y, uint8_t first, uint8_t rows) {
+    uint8_t page = ram_y >> 3;
+    uint8_t shift = ram_y & 7;
+    uint8_t *upper = &ram_[page * Width + x];
+
+    if (shift == 0 && first == 0 && rows == 8) {
+      memcpy(upper, columns, count);
+    } else {
+      uint16_t mask = ((1u << rows) - 1) << shift;
+      uint8_t upper_mask = mask, lower_mask = mask >> 8;
+      for (uint8_t i = 0; i < count; ++i) {
+        uint16_t bits = ((columns[i] >> first) << shift) & mask;
+        upper[i] = (upper[i] & ~upper_mask) | (uint8_t) bits;
+      }
+      if (lower_mask) {
+        uint8_t *lower = upper + Width;
+        for (uint8_t i = 0; i < count; ++i) {
+          uint16_t bits = ((columns[i] >> first) << shift) & mask;
+          lower[i] = (lower[i] & ~lower_mask) | (uint8_t) (bits >> 8);
+        }
+      }
+    }
+    mark_ram_dirty(x, ram_y, x + count - 1, ram_y + rows - 1);
+  }
+
+  // Copia colunas de 8 pixels (formato de página do SSD1306) para a posição
+  // (x, y) da tela, recortando embaixo e dando a volta na GDDRAM se preciso
+  void blit_columns(const uint8_t *columns, uint8_t count, uint8_t x, uint8_t y) {
+    if (x >= Width || y >= Height)
+      return;
+    if (count > Width - x)
+      count = Width - x;
+
+    uint8_t rows = MIN(8, Height - y);
+    uint8_t ram_y = ram_row(y);
+    uint8_t head = MIN(rows, Height - ram_y);
+    blit_rows(columns, count, x, ram_y, 0, head);
+    if (head < rows)
+      blit_rows(columns, count, x, 0, head, rows - head);
+  }
+
+  uint8_t ram_[kBufsize];         // Back buffer: alvo de todas as rotinas de desenho
+  uint16_t front_[kFrontWords];   // Front buffer: quadro em trânsito, em palavras IC_DATA_CMD
+  size_t front_len_;
+  i2c_inst_t *i2c_port_;
+  bool external_vcc_;
+  i2c_device_t device_;           // Painel no barramento compartilhado (i2c_bus)
+  i2c_transfer_t transfer_;       // Envio do front buffer
+  uint8_t priority_;              // Prioridade dos envios (I2C_PRIORITY_*)
+  uint8_t dirty_x0_[kPages];      // Faixa de colunas alterada em cada página
+  uint8_t dirty_x1_[kPages];      // (vazia quando dirty_x0 > dirty_x1)
+  uint16_t frame_bytes_;          // Bytes enviados no último quadro (comandos + dados)
+  uint32_t total_bytes_;          // Bytes enviados desde a inicialização
+  ssd1306_callback_t callback_;
+  void *callback_data_;
+  uint baudrate_;                 // Taxa do barramento após negotiate_baudrate
+  uint8_t start_line_;            // Linha da GDDRAM exibida no topo (rolagem vertical)
+  bool start_line_pending_;       // Nova linha inicial vai junto com o próximo envio
+  uint8_t scroll_pages_;          // Páginas sob rolagem contínua (máscara de bits)
+  uint8_t scroll_setup_[kScrollSetupMax];  // Configuração da rolagem ativa, reenviada depois de cada pausa
+  uint8_t scroll_setup_len_;
+};
+
+} // namespace ssd1306
+
+#endif
@@ -0,0 +1,76 @@
+#include "tilemap.h"
+#include <string.h>
+
+void tilemap_init(tilemap_t *map, const uint8_t *tiles, uint8_t tile_stride, uint8_t tile_width, uint8_t cols, uint8_t rows, uint8_t x, uint8_t page) {
+  map->tiles = tiles;
+  map->blocks = NULL;
+  map->tile_stride = tile_stride;
+  map->tile_width = tile_width;
+  map->cell_height = 8;
+  hard_assert(cols <= TILEMAP_MAX_COLS && rows <= TILEMAP_MAX_ROWS);
+  map->cols = cols;
+  map->rows = rows;
+  map->x = x;
+  map->y = page * 8;
+  tilemap_invalidate(map);
+}
+
+// Modo de blocos: 'blocks' dá o estilo (tilemap_block_t) de cada id
+void tilemap_init_blocks(tilemap_t *map, const uint8_t *blocks, uint8_t cell_width, uint8_t cell_height, uint8_t cols, uint8_t rows, uint8_t x, uint8_t y) {
+  map->tiles = NULL;
+  map->blocks = blocks;
+  map->tile_stride = 0;
+  map->tile_width = cell_width;
+  map->cell_height = cell_height;
+  hard_assert(cols <= TILEMAP_MAX_COLS && rows <= TILEMAP_MAX_ROWS);
+  map->cols = cols;
+  map->rows = rows;
+  map->x = x;
+  map->y = y;
+  tilemap_invalidate(map);
+}
+
+// Força o redesenho de todas as células no próximo tilemap_draw
+void tilemap_invalidate(tilemap_t *map) {
+  memset(map->shown, TILEMAP_UNDRAWN, sizeof(map->shown));
+}
+
+static void tilemap_draw_block(const tilemap_t *map, ssd1306_t *ssd, uint8_t style, uint8_t left, uint8_t top) {
+  uint8_t width = map->tile_width, height = map->cell_height;
+  ssd1306_rect(ssd, top, left, width, height, false, true);
+  switch (style) {
+    case TILEMAP_BLOCK_SOLID:
+      ssd1306_rect(ssd, top, left, width, height, true, true);
+      break;
+    case TILEMAP_BLOCK_SPACED:
+      ssd1306_rect(ssd, top, left, MAX(width - 1, 1), MAX(height - 1, 1), true, true);
+      break;
+    case TILEMAP_BLOCK_FRAME:
+      ssd1306_rect(ssd, top, left, width, height, true, false);
+      break;
+  }
+}
+
+// Desenha o mapa 'ids' (rows x cols, linha a linha, 'stride' ids entre o
+// início de uma linha e o da seguinte) comparando com o quadro anterior.
+// Retorna quantas células foram redesenhadas.
+uint tilemap_draw(tilemap_t *map, ssd1306_t *ssd, const uint8_t *ids, uint stride) {
+  uint drawn = 0;
+  for (uint8_t row = 0; row < map->rows; ++row) {
+    const uint8_t *line = &ids[row * stride];
+    uint8_t *shown = map->shown[row];
+    uint8_t top = map->y + row * map->cell_height;
+    for (uint8_t col = 0; col < map->cols; ++col) {
+      if (line[col] == shown[col])
+        continue;
+      shown[col] = line[col];
+      uint8_t left = map->x + col * map->tile_width;
+      if (map->blocks)
+        tilemap_draw_block(map, ssd, map->blocks[line[col]], left, top);
+      else
+        ssd1306_draw_bitmap(ssd, &map->tiles[line[col] * map->tile_stride], map->tile_width, left, top);
+      drawn++;
+    }
+  }
+  return drawn;
+}
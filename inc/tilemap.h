@@ -0,0 +1,45 @@
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+
+#define TILEMAP_MAX_COLS 32       // Linha de um bitboard do campo
+#define TILEMAP_MAX_ROWS 64       // Uma linha de pixels por célula, no limite
+#define TILEMAP_UNDRAWN 0xFF      // Célula ainda não desenhada
+
+// Estilos do modo de blocos: cada id vira um retângulo, sem bitmap
+typedef enum {
+  TILEMAP_BLOCK_EMPTY,            // Célula apagada
+  TILEMAP_BLOCK_SOLID,            // Célula cheia
+  TILEMAP_BLOCK_SPACED,           // Cheia menos a última coluna e a última linha (vizinhos separados)
+  TILEMAP_BLOCK_FRAME             // Só o contorno
+} tilemap_block_t;
+
+// Mapa de células do SSD1306. O mapa desenhado no quadro anterior é
+// guardado, e só as células que mudaram são redesenhadas (e, portanto,
+// retransmitidas). Há dois modos:
+// - tiles: cada célula é um bitmap de uma página de altura e tile_width
+//   colunas, alinhado às páginas;
+// - blocos: células de tile_width x cell_height pixels em qualquer linha,
+//   desenhadas como retângulos conforme o estilo do id. Serve a campos
+//   grandes demais para tiles de uma página.
+// cols e rows não podem passar de TILEMAP_MAX_COLS/ROWS; quem usa um tamanho
+// fixo deve verificá-lo em tempo de compilação.
+typedef struct {
+  const uint8_t *tiles;           // tile_stride bytes por tile, indexados pelo id
+  const uint8_t *blocks;          // Modo de blocos: tilemap_block_t de cada id
+  uint8_t tile_stride;
+  uint8_t tile_width;             // Colunas desenhadas de cada célula (<= tile_stride)
+  uint8_t cell_height;            // 8 no modo de tiles
+  uint8_t cols, rows;
+  uint8_t x, y;                   // Canto superior esquerdo na tela
+  uint8_t shown[TILEMAP_MAX_ROWS][TILEMAP_MAX_COLS];
+} tilemap_t;
+
+void tilemap_init(tilemap_t *map, const uint8_t *tiles, uint8_t tile_stride, uint8_t tile_width, uint8_t cols, uint8_t rows, uint8_t x, uint8_t page);
+void tilemap_init_blocks(tilemap_t *map, const uint8_t *blocks, uint8_t cell_width, uint8_t cell_height, uint8_t cols, uint8_t rows, uint8_t x, uint8_t y);
+void tilemap_invalidate(tilemap_t *map);
+uint tilemap_draw(tilemap_t *map, ssd1306_t *ssd, const uint8_t *ids, uint stride);
+
+#endif
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Compara uma execução do benchmark (bench/bench.c) com um baseline.
+
+Uso: python3 tools/bench_compare.py atual.csv bench/baseline_host.csv [--tolerance 0.25]
+     python3 tools/bench_compare.py atual.csv novo_baseline.csv --update
+
+Sinaliza regressão quando a mediana passa do baseline mais a tolerância
+(com piso de 20 ns para casos muito curtos) ou quando os bytes enviados por
+quadro mudam. Retorna 1 se houver regressão.
+"""
+import argparse
+import csv
+import shutil
+import sys
+
+NOISE_FLOOR_NS = 20
+
+
+def load(path):
+    rows = {}
+    with open(path, newline="") as f:
+        for row in csv.DictReader(line for line in f if not line.startswith("#")):
+            rows[row["name"]] = row
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("current")
+    parser.add_argument("baseline")
+    parser.add_argument("--tolerance", type=float, default=0.25)
+    parser.add_argument("--update", action="store_true", help="substitui o baseline pela execução atual")
+    args = parser.parse_args()
+
+    if args.update:
+        shutil.copyfile(args.current, args.baseline)
+        return 0
+
+    current, baseline = load(args.current), load(args.baseline)
+    failed = False
+    print(f"{'name':28} {'base_ns':>10} {'now_ns':>10} {'delta':>8}  status")
+    for name, base in baseline.items():
+        now = current.get(name)
+        if now is None:
+            print(f"{name:28} {'':>10} {'':>10} {'':>8}  MISSING")
+            failed = True
+            continue
+        b, n = int(base["median_ns"]), int(now["median_ns"])
+        delta = (n - b) / b if b else 0.0
+        status = "ok"
+        if n > b * (1 + args.tolerance) and n - b > NOISE_FLOOR_NS:
+            status = "REGRESSION"
+        if base["bytes"] != now["bytes"]:
+            status = f"BYTES {base['bytes']} -> {now['bytes']}"
+        failed |= status != "ok"
+        print(f"{name:28} {b:>10} {n:>10} {delta:>+8.1%}  {status}")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
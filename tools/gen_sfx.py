@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Gera inc/sfx.h: efeitos sonoros PCM de 8 bits (sem sinal, centro 128).
+
+Uso: python3 tools/gen_sfx.py > inc/sfx.h
+"""
+import math
+
+RATE = 8000
+
+
+def lcg(seed=0x1234):
+    # Ruído determinístico para que o cabeçalho gerado seja reproduzível
+    while True:
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        yield (seed >> 16) / 32768.0 * 2.0 - 1.0
+
+
+def explosion(duration=0.35):
+    noise = lcg()
+    out, low = [], 0.0
+    n = int(RATE * duration)
+    for i in range(n):
+        t = i / RATE
+        low += 0.25 * (next(noise) - low)          # passa-baixas de um polo
+        out.append(low * math.exp(-t * 9.0) * 1.6)
+    return out
+
+
+def level_up():
+    out = []
+    for freq, duration in ((523, 0.07), (659, 0.07), (784, 0.07), (1047, 0.12)):
+        n = int(RATE * duration)
+        for i in range(n):
+            square = 1.0 if (i * freq * 2 // RATE) % 2 == 0 else -1.0
+            out.append(square * 0.8 * (1.0 - i / n * 0.5))
+    return out
+
+
+def emit(name, samples):
+    data = [max(0, min(255, int(round(128 + s * 127)))) for s in samples]
+    print(f"static const uint8_t {name}_data[{len(data)}] = {{")
+    for i in range(0, len(data), 16):
+        print("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    print("};")
+    print(f"static const pcm_sample_t {name} = {{{name}_data, sizeof({name}_data)}};")
+    print()
+
+
+print("// Gerado por tools/gen_sfx.py -- não editar manualmente")
+print(f"// PCM de 8 bits sem sinal, {RATE} Hz")
+print('#include "pcm.h"')
+print()
+emit("sfx_explosion", explosion())
+emit("sfx_level_up", level_up())
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Remonta o log de entradas (inc/replay.h) a partir da saída do firmware.
+
+O firmware envia o log pela USB em linhas "@rpl <offset hex> <bytes hex>",
+misturadas ao texto do jogo. Cada "RPL1" no offset 0 começa um log novo
+(reinício da placa); por padrão é salvo o último.
+
+Uso:
+    python3 tools/replay_extract.py captura.txt partida.rpl
+    ProjetoIntegrado_host --seconds 60 | python3 tools/replay_extract.py - partida.rpl
+    ProjetoIntegrado_host --replay partida.rpl
+"""
+import argparse
+import sys
+
+
+def extract(lines):
+    logs = []
+    for number, line in enumerate(lines, 1):
+        line = line.strip()
+        if not line.startswith("@rpl "):
+            continue
+        try:
+            _, offset, data = line.split()
+            offset = int(offset, 16)
+            data = bytes.fromhex(data)
+        except ValueError:
+            print("linha %d: @rpl malformada, ignorada" % number, file=sys.stderr)
+            continue
+        if offset == 0:
+            logs.append(bytearray())
+        if not logs or offset != len(logs[-1]):
+            raise SystemExit("linha %d: offset %#x fora de sequência (linha perdida?)" % (number, offset))
+        logs[-1] += data
+    return logs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="captura de texto ('-' para stdin)")
+    parser.add_argument("output", help="arquivo binário do log")
+    parser.add_argument("--index", type=int, default=-1, help="qual log salvar quando houver vários (padrão: o último)")
+    args = parser.parse_args()
+
+    source = sys.stdin if args.source == "-" else open(args.source, errors="replace")
+    logs = extract(source)
+    if not logs:
+        raise SystemExit("nenhum log @rpl encontrado")
+    log = logs[args.index]
+    with open(args.output, "wb") as out:
+        out.write(log)
+    seed = int.from_bytes(log[4:8], "little")
+    print("%d log(s); salvo %d bytes (semente %d) em %s" % (len(logs), len(log), seed, args.output), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Decodifica a telemetria binária do profiler (inc/profiler.c).
+
+Os pacotes chegam intercalados com o texto do printf na mesma porta USB CDC:
+
+    0xA5 0x5A | tipo | tamanho | carga | Fletcher-16 (tipo..carga)
+
+O texto fora dos pacotes é repassado para stderr.
+
+Uso:
+    python3 tools/telemetry_decode.py /dev/ttyACM0
+    ProjetoIntegrado_host --seconds 10 | python3 tools/telemetry_decode.py -
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = b"\xa5\x5a"
+PACKET_SUMMARY = 1
+PACKET_HISTOGRAM = 2
+
+# Mesma ordem de profile_zone_t e profile_bus_t
+ZONES = ["input", "logic", "matrix", "oled", "flush", "idle"]
+BUSES = ["i2c", "pio"]
+HIST_BUCKETS = 16
+FRAME_BUCKET_US = 2000
+BUS_BUCKET_US = 1000
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for byte in data:
+        sum1 = (sum1 + byte) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+def packets(stream, text_out):
+    """Gera (tipo, carga) a partir do fluxo de bytes, ressincronizando no magic."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            start = buf.find(MAGIC)
+            if start < 0:
+                # Guarda um possível primeiro byte do magic no fim do buffer
+                keep = 1 if buf.endswith(MAGIC[:1]) else 0
+                text_out.write(buf[:len(buf) - keep].decode("utf-8", "replace"))
+                del buf[:len(buf) - keep]
+                break
+            if start:
+                text_out.write(buf[:start].decode("utf-8", "replace"))
+                del buf[:start]
+            if len(buf) < 4:
+                break
+            length = buf[3]
+            if len(buf) < 6 + length:
+                break
+            body = bytes(buf[2:4 + length])
+            if fletcher16(body) != tuple(buf[4 + length:6 + length]):
+                # Falso magic dentro do texto: descarta um byte e procura de novo
+                text_out.write(buf[:1].decode("utf-8", "replace"))
+                del buf[:1]
+                continue
+            del buf[:6 + length]
+            yield body[0], body[2:]
+
+
+def print_summary(payload):
+    values = struct.unpack("<%dH" % (len(payload) // 2), payload)
+    seq, frames, frame_avg, frame_max = values[:4]
+    zones = values[4:4 + len(ZONES)]
+    buses = values[4 + len(ZONES):4 + len(ZONES) + len(BUSES)]
+    busy = sum(zones[:-1])
+    load = 100.0 * busy / frame_avg if frame_avg else 0.0
+    fields = " ".join("%s=%d" % (name, us) for name, us in zip(ZONES, zones))
+    fields += " " + " ".join("%s=%d" % (name, us) for name, us in zip(BUSES, buses))
+    print("#%-5d frames=%-3d frame avg=%5d max=%5d us  %s  load=%.1f%%" %
+          (seq, frames, frame_avg, frame_max, fields, load))
+
+
+def print_histogram(name, counts, bucket_us):
+    total = sum(counts) or 1
+    print("  %s:" % name)
+    for i, count in enumerate(counts):
+        if not count:
+            continue
+        upper = "+" if i == HIST_BUCKETS - 1 else "%d" % ((i + 1) * bucket_us // 1000)
+        bar = "#" * max(1, 40 * count // total)
+        print("    %3d..%-3s ms %6d %s" % (i * bucket_us // 1000, upper, count, bar))
+
+
+def print_histograms(payload):
+    values = struct.unpack("<%dH" % (len(payload) // 2), payload)
+    print("histograms (#%d)" % values[0])
+    print_histogram("frame", values[1:1 + HIST_BUCKETS], FRAME_BUCKET_US)
+    for i, name in enumerate(BUSES):
+        start = 1 + HIST_BUCKETS * (i + 1)
+        print_histogram(name, values[start:start + HIST_BUCKETS], BUS_BUCKET_US)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="porta serial ou arquivo capturado ('-' para stdin)")
+    parser.add_argument("--quiet", action="store_true", help="descarta o texto fora dos pacotes")
+    args = parser.parse_args()
+
+    stream = sys.stdin.buffer if args.source == "-" else open(args.source, "rb", buffering=0)
+    text_out = open("/dev/null", "w") if args.quiet else sys.stderr
+    try:
+        for kind, payload in packets(stream, text_out):
+            if kind == PACKET_SUMMARY:
+                print_summary(payload)
+            elif kind == PACKET_HISTOGRAM:
+                print_histograms(payload)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())